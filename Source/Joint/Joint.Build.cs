@@ -45,6 +45,7 @@ public class Joint : ModuleRules
 				"UMG",
 				"ICU",
 				"DeveloperSettings",
+				"NetCore",
 
 				// Gameplay abilities with
 				"GameplayTags",
@@ -8,6 +8,7 @@
 #include "Node/JointNodeBase.h"
 #include "Joint.h"
 #include "JointLogChannels.h"
+#include "JointStats.h"
 #include "Subsystem/JointSubsystem.h"
 
 #include "Engine/ActorChannel.h"
@@ -16,6 +17,7 @@
 
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "TimerManager.h"
 
 #include "Misc/EngineVersionComparison.h"
@@ -68,8 +70,53 @@
 	} while (0)
 
 
+DECLARE_CYCLE_STAT(TEXT("Process Execution Queue"), STAT_JointProcessExecutionQueue, STATGROUP_Joint);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Execution Elements Processed"), STAT_JointExecutionElementsProcessed, STATGROUP_Joint);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Execution Queue Peak Depth"), STAT_JointExecutionQueuePeakDepth, STATGROUP_Joint);
+
+/**
+ * The deepest execution queue among all the Joint actors since the start, for STAT_JointExecutionQueuePeakDepth.
+ */
+static int32 GJointExecutionQueuePeakDepth = 0;
+
+/**
+ * The stack of the Joint actors that are executing the shared node objects at the moment.
+ * Only accessed on the game thread, so no synchronization is needed here.
+ */
+static TArray<AJointActor*, TInlineAllocator<4>> GJointSharedExecutionContextStack;
+
+/**
+ * The Joint actors that play each Joint manager asset with the shared node objects. Only accessed on the game thread.
+ */
+static TMap<TObjectKey<UJointManager>, TArray<TWeakObjectPtr<AJointActor>>> GJointSharedManagerPlayers;
+
+/**
+ * Push the Joint actor as the shared execution context while the scope is alive.
+ * Does nothing if the Joint actor doesn't use the shared Joint manager.
+ */
+struct FJointScopedSharedExecutionContext
+{
+	explicit FJointScopedSharedExecutionContext(AJointActor* InJointActor)
+		: bPushed(InJointActor != nullptr && InJointActor->bIsUsingSharedJointManager)
+	{
+		if (bPushed) GJointSharedExecutionContextStack.Push(InJointActor);
+	}
+
+	~FJointScopedSharedExecutionContext()
+	{
+		if (bPushed) GJointSharedExecutionContextStack.Pop();
+	}
+
+private:
+
+	bool bPushed;
+};
+
+
+FName AJointActor::AbilitySystemComponentName(TEXT("AbilitySystemComponent"));
+
 // Sets default values
-AJointActor::AJointActor()
+AJointActor::AJointActor(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	//Joint Actor can not tick.
 	PrimaryActorTick.bCanEverTick = false;
@@ -91,13 +138,48 @@ AJointActor::AJointActor()
 
 UAbilitySystemComponent* AJointActor::GetAbilitySystemComponent() const
 {
+	if (AbilitySystemComponent) return AbilitySystemComponent;
+
+	//The clients can have the replicated component that hasn't been picked up yet.
+	return FindComponentByClass<UAbilitySystemComponent>();
+}
+
+UAbilitySystemComponent* AJointActor::EnsureAbilitySystemComponent()
+{
+	CreateAbilitySystemComponentOnDemand();
+
 	return AbilitySystemComponent;
 }
 
 void AJointActor::ImplementAbilitySystemComponent()
 {
-	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
+	//Optional - the subclasses can skip it. (See AJointActor_Lightweight)
+	AbilitySystemComponent = CreateOptionalDefaultSubobject<UAbilitySystemComponent>(AbilitySystemComponentName);
+	
+	if (AbilitySystemComponent) AbilitySystemComponent->SetIsReplicated(true);
+}
+
+bool AJointActor::CreateAbilitySystemComponentOnDemand()
+{
+	if (AbilitySystemComponent) return true;
+
+	//Clients pick up the component that has been replicated from the authority.
+	if (!HasAuthority())
+	{
+		AbilitySystemComponent = FindComponentByClass<UAbilitySystemComponent>();
+
+		return AbilitySystemComponent != nullptr;
+	}
+
+	if (GetWorld() == nullptr || IsActorBeingDestroyed()) return false;
+
+	AbilitySystemComponent = NewObject<UAbilitySystemComponent>(this, AbilitySystemComponentName);
 	AbilitySystemComponent->SetIsReplicated(true);
+	AbilitySystemComponent->RegisterComponent();
+
+	AddInstanceComponent(AbilitySystemComponent);
+
+	return true;
 }
 
 void AJointActor::OnRep_JointManager(const UJointManager* PreviousJointManager)
@@ -112,6 +194,88 @@ void AJointActor::OnRep_JointManager(const UJointManager* PreviousJointManager)
 	RequestSetJointManager(JointManager);
 }
 
+bool AJointActor::IsUsingSharedJointManager() const
+{
+	return bIsUsingSharedJointManager;
+}
+
+bool AJointActor::CanShareJointManager(UJointManager* InJointManager)
+{
+	if (InJointManager == nullptr) return false;
+
+	auto CanShareNode = [](const UJointNodeBase* Node)
+	{
+		return Node == nullptr || (Node->bCanBeSharedAcrossInstances && !Node->GetReplicates());
+	};
+
+	for (const UJointNodeBase* Node : InJointManager->GetNodeTable().Nodes)
+	{
+		if (!CanShareNode(Node)) return false;
+	}
+
+	return true;
+}
+
+const FJointNodeRuntimeState* AJointActor::FindSharedNodeRuntimeState(const UJointNodeBase* InNode) const
+{
+	return SharedNodeRuntimeStates.Find(InNode);
+}
+
+FJointNodeRuntimeState& AJointActor::FindOrAddSharedNodeRuntimeState(const UJointNodeBase* InNode)
+{
+	return SharedNodeRuntimeStates.FindOrAdd(InNode);
+}
+
+AJointActor* AJointActor::GetSharedExecutionContext()
+{
+	return GJointSharedExecutionContextStack.Num() > 0 ? GJointSharedExecutionContextStack.Last() : nullptr;
+}
+
+int32 AJointActor::FindSharedJointManagerPlayers(const UJointManager* InJointManager, AJointActor*& OutFirstPlayer)
+{
+	OutFirstPlayer = nullptr;
+
+	const TArray<TWeakObjectPtr<AJointActor>>* Players = GJointSharedManagerPlayers.Find(InJointManager);
+
+	if (Players == nullptr) return 0;
+
+	int32 NumPlayers = 0;
+
+	for (const TWeakObjectPtr<AJointActor>& Player : *Players)
+	{
+		//The actors that have no state (ex, pooled or not started yet) don't play any node at the moment.
+		if (!Player.IsValid() || Player->SharedNodeRuntimeStates.IsEmpty()) continue;
+
+		if (OutFirstPlayer == nullptr) OutFirstPlayer = Player.Get();
+
+		if (++NumPlayers == 2) break;
+	}
+
+	return NumPlayers;
+}
+
+void AJointActor::RegisterAsSharedJointManagerPlayer()
+{
+	if (!bIsUsingSharedJointManager || JointManager == nullptr) return;
+
+	GJointSharedManagerPlayers.FindOrAdd(JointManager).AddUnique(this);
+}
+
+void AJointActor::UnregisterAsSharedJointManagerPlayer()
+{
+	if (!bIsUsingSharedJointManager || JointManager == nullptr) return;
+
+	if (TArray<TWeakObjectPtr<AJointActor>>* Players = GJointSharedManagerPlayers.Find(JointManager))
+	{
+		Players->RemoveAll([this](const TWeakObjectPtr<AJointActor>& Player)
+		{
+			return !Player.IsValid() || Player.Get() == this;
+		});
+
+		if (Players->IsEmpty()) GJointSharedManagerPlayers.Remove(JointManager);
+	}
+}
+
 void AJointActor::ProcessExecutionQueue(bool bForceTakeHandle)
 {
 	// if bForceTakeHandle is true, we allow re-entrance into this function. This is useful when we want to process the queue right now even if it is already being processed.
@@ -120,12 +284,18 @@ void AJointActor::ProcessExecutionQueue(bool bForceTakeHandle)
 	 
 	if ( bIsProcessingExecutionQueue ) return;
 	
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+	
+	SCOPE_CYCLE_COUNTER(STAT_JointProcessExecutionQueue);
+	
 	bIsProcessingExecutionQueue = true;
 	
 	// check bIsProcessingExecutionQueue here to let it stop 
-	while (ExecutionQueue.Num() > 0 && bIsProcessingExecutionQueue )
+	while (!ExecutionQueue.IsEmpty() && bIsProcessingExecutionQueue )
 	{
 		PopExecutionQueue();
+
+		INC_DWORD_STAT(STAT_JointExecutionElementsProcessed);
 	}
 	
 	bIsProcessingExecutionQueue = false;
@@ -133,12 +303,30 @@ void AJointActor::ProcessExecutionQueue(bool bForceTakeHandle)
 
 void AJointActor::EnqueueExecutionElement(const FJointActorExecutionElement& NewElement)
 {
-	ExecutionQueue.Add(NewElement);
+	ExecutionQueue.Enqueue(NewElement);
+
+	if (ExecutionQueue.GetPeakNum() > GJointExecutionQueuePeakDepth)
+	{
+		GJointExecutionQueuePeakDepth = ExecutionQueue.GetPeakNum();
+
+		SET_DWORD_STAT(STAT_JointExecutionQueuePeakDepth, GJointExecutionQueuePeakDepth);
+	}
+}
+
+TArray<FJointActorExecutionElement> AJointActor::GetQueuedExecutionElements() const
+{
+	return ExecutionQueue.ToArray();
+}
+
+int32 AJointActor::GetExecutionQueuePeakDepth() const
+{
+	return ExecutionQueue.GetPeakNum();
 }
 
 void AJointActor::PopExecutionQueue()
 {
-	const FJointActorExecutionElement Item = ExecutionQueue[0];
+	// Copy the element since processing it can enqueue new elements and grow the queue.
+	const FJointActorExecutionElement Item = ExecutionQueue.Peek();
 	
 #if WITH_EDITOR
 	
@@ -168,30 +356,27 @@ void AJointActor::PopExecutionQueue()
 
 #endif
 	
+	// Pop it before processing, since processing the element can enqueue new elements.
+	ExecutionQueue.Pop();
+	
 	switch (Item.ExecutionType)
 	{
 	case EJointActorExecutionType::PreBeginPlay:
-		ExecutionQueue.RemoveAt(0);
 		ProcessPreNodeBeginPlay(Item.TargetNode.Get());
 		break;
 	case EJointActorExecutionType::PostBeginPlay:
-		ExecutionQueue.RemoveAt(0);
 		ProcessPostNodeBeginPlay(Item.TargetNode.Get());
 		break;
 	case EJointActorExecutionType::PrePending:
-		ExecutionQueue.RemoveAt(0);
 		ProcessPreMarkNodeAsPending(Item.TargetNode.Get());
 		break;
 	case EJointActorExecutionType::PostPending:
-		ExecutionQueue.RemoveAt(0);
 		ProcessPostMarkNodeAsPending(Item.TargetNode.Get());
 		break;
 	case EJointActorExecutionType::PreEndPlay:
-		ExecutionQueue.RemoveAt(0);
 		ProcessPreNodeEndPlay(Item.TargetNode.Get());
 		break;
 	case EJointActorExecutionType::PostEndPlay:
-		ExecutionQueue.RemoveAt(0);
 		ProcessPostNodeEndPlay(Item.TargetNode.Get());
 		break;
 	case EJointActorExecutionType::None:
@@ -223,9 +408,20 @@ void AJointActor::ClearExecutionQueue()
 	ExecutionQueue.Empty();
 }
 
+void AJointActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UJointSubsystem* SubSystem = UJointSubsystem::Get(this)) SubSystem->UpdateJointRegistration(this);
+}
+
 void AJointActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	EndJoint();
+
+	if (UJointSubsystem* SubSystem = UJointSubsystem::Get(this)) SubSystem->UnregisterJoint(this);
+
+	UnregisterAsSharedJointManagerPlayer();
 	
 	Super::EndPlay(EndPlayReason);
 }
@@ -292,7 +488,16 @@ void AJointActor::RequestSetJointManager_Implementation(UJointManager* NewJointM
 {
 	if (NewJointManager != nullptr)
 	{
-		UJointManager* DuplicatedJointManager = DuplicateObject<UJointManager>(NewJointManager, this);
+		UnregisterAsSharedJointManagerPlayer();
+
+		SharedNodeRuntimeStates.Reset();
+
+		SourceJointManager = NewJointManager;
+
+		// Shared node objects are owned by the asset, so only the assets can be shared.
+		bIsUsingSharedJointManager = InstancingPolicy == EJointManagerInstancingPolicy::Shared
+			&& NewJointManager->IsAsset()
+			&& CanShareJointManager(NewJointManager);
 
 #if WITH_EDITOR
 		//For debugging purpose.
@@ -300,12 +505,26 @@ void AJointActor::RequestSetJointManager_Implementation(UJointManager* NewJointM
 		OriginalJointManager = NewJointManager;
 #endif
 
-		JointManager = DuplicatedJointManager;
+		JointManager = bIsUsingSharedJointManager
+			? NewJointManager
+			: DuplicateObject<UJointManager>(NewJointManager, this);
+
+		RegisterAsSharedJointManagerPlayer();
+
+		// Build the fragment lookup tables up front. (No-op for the shared managers that already have them built.)
+		JointManager->BuildFragmentIndices();
+
+		if (NewJointManager->bRequiresAbilitySystemComponent && HasAuthority()) CreateAbilitySystemComponentOnDemand();
+
+		// The Joint manager index of the registry has to follow the new manager.
+		if (UJointSubsystem* SubSystem = UJointSubsystem::Get(this)) SubSystem->UpdateJointRegistration(this);
 		
 		//SetJointManager(DuplicatedJointManager);
 		
 		// Cache nodes for networking here because the Joint Manager has changed.
 		// This is also necessary because sometimes we need to start replicating nodes before the Joint starts playing (especially for the participants)
+		bIsNodesForNetworkingDirty = true;
+		
 		CacheNodesForNetworking();
 
 #if DEBUG_ShowJointEvent_SetJoint
@@ -321,8 +540,16 @@ UJointManager* AJointActor::GetJointManager()
 	return JointManager;
 }
 
+UJointManager* AJointActor::GetSourceJointManager() const
+{
+	return SourceJointManager;
+}
+
 void AJointActor::OnNotifiedCurrentNodePending(UJointNodeBase* Node)
 {
+	//Shared nodes broadcast their events to every Joint actor that plays them. Ignore the events from the other actors' playback.
+	if (bIsUsingSharedJointManager && GetSharedExecutionContext() != this) return;
+	
 #if DEBUG_ShowNodeEvent_Pending
 	
 	JOINT_DEBUG_LOG(this, FColor::Yellow, TEXT("%s, %s, %s: OnNotifiedCurrentNodePending, Node : %s "),
@@ -341,6 +568,9 @@ void AJointActor::OnNotifiedCurrentNodePending(UJointNodeBase* Node)
 
 void AJointActor::OnNotifiedCurrentNodeEnded(UJointNodeBase* Node)
 {
+	//Shared nodes broadcast their events to every Joint actor that plays them. Ignore the events from the other actors' playback.
+	if (bIsUsingSharedJointManager && GetSharedExecutionContext() != this) return;
+	
 	if (HasAuthority())
 	{
 		PlayNextNode();
@@ -376,6 +606,8 @@ void AJointActor::BindEventsOnPlayingJointNode_Implementation()
 
 void AJointActor::SetPlayingJointNode_Implementation(UJointNodeBase* NewPlayingJointNode)
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+	
 	PlayingJointNode = NewPlayingJointNode;
 
 	//Reload the node's activity related flags.
@@ -431,12 +663,21 @@ bool AJointActor::IsJointEnded()
 	return bIsJointEnded;
 }
 
+EJointActorPlaybackState AJointActor::GetPlaybackState() const
+{
+	if (bIsJointEnded) return EJointActorPlaybackState::Ended;
+
+	return bIsJointStarted ? EJointActorPlaybackState::Running : EJointActorPlaybackState::Idle;
+}
+
 void AJointActor::StartJoint_Implementation()
 {
 	if (IsJointStarted()) return;
 
 	if (JointManager == nullptr) return;
 
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 #if DEBUG_ShowJointEvent_StartJoint
 
 	JOINT_DEBUG_LOG(this, FColor::Emerald, TEXT("%s, %s, %s: JointStarted, Joint Manager : %s"), *JointManager->GetName());
@@ -479,6 +720,8 @@ void AJointActor::EndJoint_Implementation()
 
 	if (JointManager == nullptr) return;
 
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 #if DEBUG_ShowJointEvent_EndJoint
 
 	JOINT_DEBUG_LOG(this, FColor::Emerald, TEXT("%s, %s, %s: JointEnded"));
@@ -510,6 +753,8 @@ void AJointActor::EndJoint_Implementation()
 
 void AJointActor::ForceEndAllKnownActiveNodes()
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 	TArray<UJointNodeBase*> CopiedKnownActiveNodes = KnownActiveNodes;
 
 	for (int i = CopiedKnownActiveNodes.Num() - 1; i > INDEX_NONE; --i)
@@ -545,18 +790,100 @@ void AJointActor::DestroyJoint_Implementation()
 	
 	if (IsValidLowLevel() && GetWorld())
 	{
+		//DestroyJoint() can be called several times before the next tick (ex, by the user and on the Joint end) - schedule it only once.
+		if (GetWorld()->GetTimerManager().TimerExists(DestroyInstanceTimerHandle)) return;
+
 		//Destroy on the next tick for additional clean up.
-		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &AJointActor::DestroyInstance);
+		DestroyInstanceTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &AJointActor::DestroyInstance);
 	}
 }
 
 void AJointActor::DestroyInstance()
 {
+	DestroyInstanceTimerHandle.Invalidate();
+
+	//Pooled instances go back to the pool instead. The pool can refuse it when it is full.
+	if (IsPooledInstance())
+	{
+		if (UJointSubsystem* SubSystem = UJointSubsystem::Get(this); SubSystem && SubSystem->ReleaseJointToPool(this)) return;
+	}
+	
 	Destroy();
 }
 
+bool AJointActor::IsPooledInstance() const
+{
+	return bIsPooledInstance;
+}
+
+void AJointActor::ResetJointForReuse()
+{
+	//The actor is handed over to a new user - a destruction that has been requested by the previous user must not reach it.
+	if (GetWorld()) GetWorld()->GetTimerManager().ClearTimer(DestroyInstanceTimerHandle);
+
+	ClearExecutionQueue();
+
+	//The peak depth belongs to the previous playback.
+	ExecutionQueue.ResetPeakNum();
+
+	PlayingJointNode = nullptr;
+
+	KnownActiveNodes.Empty();
+
+	LookAheadNodesForNetworking.Empty();
+
+	EndedNodesPendingNetworkingRemoval.Empty();
+	EndedNodesReadyForNetworkingRemoval.Empty();
+
+	bIsJointStarted = false;
+	bIsJointEnded = false;
+
+	JointGuid = FGuid::NewGuid();
+
+	OnJointStartedDelegate.Clear();
+	OnJointEndedDelegate.Clear();
+	OnJointBaseNodePlayedDelegate.Clear();
+	OnJointNodeBeginPlayDelegate.Clear();
+	OnJointNodeEndPlayDelegate.Clear();
+	OnJointNodeMarkedAsPendingDelegate.Clear();
+
+	// The guid and the playback state have been changed.
+	if (UJointSubsystem* SubSystem = UJointSubsystem::Get(this)) SubSystem->UpdateJointRegistration(this);
+
+	bIsNodesForNetworkingDirty = true;
+
+	if (JointManager == nullptr) return;
+
+	//Shared nodes hold their runtime state on this actor.
+	if (bIsUsingSharedJointManager)
+	{
+		SharedNodeRuntimeStates.Reset();
+
+		return;
+	}
+
+	const FJointManagerNodeTable& NodeTable = JointManager->GetNodeTable();
+
+	for (const UJointNodeBase* Node : NodeTable.Nodes)
+	{
+		if (Node->CanReloadNode()) continue;
+
+		//Some nodes are not allowed to be played again - instance the manager again.
+		if (SourceJointManager) RequestSetJointManager(SourceJointManager);
+
+		return;
+	}
+
+	for (int32 Index = 0; Index < NodeTable.Num(); ++Index)
+	{
+		if (NodeTable.IsRootEntry(Index)) RequestReloadNode(NodeTable.Nodes[Index], true);
+	}
+}
+
 void AJointActor::ProcessStartJoint_Implementation()
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 	MarkAsStarted();
 
 	NotifyStartJoint();
@@ -571,6 +898,8 @@ void AJointActor::ProcessStartJoint_Implementation()
 
 void AJointActor::ProcessEndJoint_Implementation()
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 	EndManagerFragments();
 
 	ForceEndAllKnownActiveNodes();
@@ -610,6 +939,8 @@ void AJointActor::PlayNextNode_Implementation()
 {
 	if (JointManager == nullptr) return;
 
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 #if DEBUG_ShowJointEvent_PlayNextNode
 
 	JOINT_DEBUG_LOG(this, FColor::Emerald, TEXT("%s, %s, %s: PlayNextNode - Begin"));
@@ -650,6 +981,8 @@ void AJointActor::ProcessPlayNextNode_Implementation()
 
 void AJointActor::RequestNodeBeginPlay(UJointNodeBase* InNode)
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+	
 	//check if the node can be begun play.
 	if (!InNode) return;
 	
@@ -666,6 +999,8 @@ void AJointActor::RequestNodeBeginPlay(UJointNodeBase* InNode)
 
 void AJointActor::RequestNodeEndPlay(UJointNodeBase* InNode)
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+	
 	//check if the node can be ended play.
 	if (!InNode) return;
 	
@@ -682,6 +1017,8 @@ void AJointActor::RequestNodeEndPlay(UJointNodeBase* InNode)
 
 void AJointActor::RequestMarkNodeAsPending(UJointNodeBase* InNode)
 {
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+	
 	//check if the node can be ended play.
 	if (!InNode) return;
 	
@@ -700,6 +1037,8 @@ void AJointActor::RequestReloadNode(UJointNodeBase* InNode, const bool bPropagat
 {
 	if (!InNode) return;
 
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 	const bool& bCanReloadNode = InNode->CanReloadNode();
 	
 	if (bCanReloadNode) InNode->ReloadNode();
@@ -771,7 +1110,8 @@ void AJointActor::ProcessPreNodeBeginPlay(UJointNodeBase* InNode)
 		if (this->PlayingJointNode != InNode && !GetJointManager()->ManagerFragments.Contains(InNode)) return;
 	}
 
-	InNode->SetHostingJointInstance(this);
+	//Shared nodes can be played by multiple Joint actors at once, so they must not cache the hosting instance.
+	if (!bIsUsingSharedJointManager) InNode->SetHostingJointInstance(this);
 
 #if WITH_EDITOR
 
@@ -785,6 +1125,8 @@ void AJointActor::ProcessPreNodeBeginPlay(UJointNodeBase* InNode)
 
 	KnownActiveNodes.Add(InNode);
 
+	if (NodeReplicationPolicy == EJointNodeReplicationPolicy::ActiveNodes && InNode->GetReplicates()) AddNodeForNetworking(InNode);
+
 	InNode->ProcessPreNodeBeginPlay();
 }
 
@@ -795,6 +1137,9 @@ void AJointActor::ProcessPostNodeBeginPlay(UJointNodeBase* InNode)
 	if (!InNode->IsNodeBegunPlay()) return;
 
 	InNode->ProcessPostNodeBeginPlay();
+
+	//Move the look-ahead on once the playing node is in.
+	if (InNode == PlayingJointNode) RefreshLookAheadNodesForNetworking();
 }
 
 void AJointActor::ProcessPreNodeEndPlay(UJointNodeBase* InNode)
@@ -811,6 +1156,21 @@ void AJointActor::ProcessPreNodeEndPlay(UJointNodeBase* InNode)
 
 	KnownActiveNodes.Remove(InNode);
 
+	//The node is dropped from the replicated node list only after the changes it makes on its end play have been sent. (See FlushEndedNodesForNetworking())
+	if (NodeReplicationPolicy == EJointNodeReplicationPolicy::ActiveNodes && HasAuthority() && !ShouldKeepInactiveNodeForNetworking(InNode))
+	{
+		if (GetNetMode() == NM_Standalone)
+		{
+			RemoveNodeForNetworking(InNode);
+		}
+		else
+		{
+			EndedNodesPendingNetworkingRemoval.AddUnique(InNode);
+
+			ForceNetUpdate();
+		}
+	}
+
 	InNode->ProcessPreNodeEndPlay();
 
 #if WITH_EDITOR
@@ -886,6 +1246,8 @@ void AJointActor::BeginManagerFragments()
 {
 	if (!JointManager) return;
 
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 	for (UJointNodeBase* ManagerFragment : JointManager->ManagerFragments)
 	{
 		if (ManagerFragment == nullptr) continue;
@@ -898,6 +1260,8 @@ void AJointActor::EndManagerFragments()
 {
 	if (!JointManager) return;
 
+	FJointScopedSharedExecutionContext SharedExecutionContext(this);
+
 	for (UJointNodeBase* ManagerFragment : JointManager->ManagerFragments)
 	{
 		if (ManagerFragment == nullptr) continue;
@@ -978,87 +1342,227 @@ bool AJointActor::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch,
 #endif
 }
 
+void AJointActor::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	if (HasAuthority()) FlushEndedNodesForNetworking();
+}
+
 
 void AJointActor::CacheNodesForNetworking()
 {
-	if (HasAuthority())
+	if (!HasAuthority()) return;
+
+	if (JointManager == nullptr) return;
+
+	if (!bIsNodesForNetworkingDirty) return;
+
+	bIsNodesForNetworkingDirty = false;
+
+	TArray<UJointNodeBase*> Nodes;
+
+	//Shared nodes never replicate. (See CanShareJointManager())
+	if (!bIsUsingSharedJointManager) CollectNodesForNetworking(Nodes);
+
+	ApplyNodesForNetworking(Nodes);
+}
+
+void AJointActor::CollectNodesForNetworking(TArray<UJointNodeBase*>& OutNodes) const
+{
+	const FJointManagerNodeTable& NodeTable = JointManager->GetNodeTable();
+
+	if (NodeReplicationPolicy == EJointNodeReplicationPolicy::ActiveNodes)
 	{
-		if (JointManager == nullptr) return;
+		for (int32 Index = 0; Index < NodeTable.NumManagerFragmentEntries; ++Index)
+		{
+			UJointNodeBase* Node = NodeTable.Nodes[Index];
 
-#if USE_NEW_REPLICATION
-		
-		for (UJointNodeBase* NodesForNetworking : CachedNodesForNetworking)
+			if (IsValid(Node) && Node->GetReplicates() && Node->IsA<UJointFragment>()) OutNodes.Add(Node);
+		}
+
+		for (UJointNodeBase* Node : KnownActiveNodes)
 		{
-			if(IsValid(NodesForNetworking))
-			{
-				RemoveNodeForNetworking(NodesForNetworking);
-			}
+			if (IsValid(Node) && Node->GetReplicates()) OutNodes.AddUnique(Node);
 		}
-		
-#endif
 
+		for (UJointNodeBase* Node : LookAheadNodesForNetworking)
+		{
+			if (IsValid(Node) && Node->GetReplicates()) OutNodes.AddUnique(Node);
+		}
 
-		CachedNodesForNetworking.Empty();
+		return;
+	}
 
-		TArray<UJointNodeBase*> Nodes;
+	// The replicated set is computed once per asset - the duplicates share the node table layout of the asset they have been duplicated from.
+	const UJointManager* LayoutSource = SourceJointManager != nullptr && SourceJointManager->GetNodeTable().HasSameLayoutAs(NodeTable)
+		? SourceJointManager.Get()
+		: JointManager.Get();
 
-		for (UJointFragment* Fragment : JointManager->GetAllManagerFragmentsOnLowerHierarchy())
-		{
-			if (IsValid(Fragment))
-			{
-				if (Fragment->bReplicates)
-				{
-					Nodes.Add(Fragment);
-				}
-			}
-		}
+	const TArray<int32>& ReplicatedIndices = LayoutSource->GetReplicatedNodeTableIndices();
+
+	OutNodes.Reserve(ReplicatedIndices.Num());
+
+	for (const int32 Index : ReplicatedIndices)
+	{
+		UJointNodeBase* Node = NodeTable.Nodes[Index];
+
+		if (IsValid(Node) && Node->GetReplicates()) OutNodes.Add(Node);
+	}
+}
+
+void AJointActor::RefreshLookAheadNodesForNetworking()
+{
+	if (!HasAuthority()) return;
+
+	if (JointManager == nullptr || bIsUsingSharedJointManager) return;
+
+	if (NodeReplicationPolicy != EJointNodeReplicationPolicy::ActiveNodes) return;
+
+	TArray<UJointNodeBase*> NewLookAheadNodes;
+
+	const FJointManagerNodeTable& NodeTable = JointManager->GetNodeTable();
+
+	const int32 PlayingNodeIndex = PlayingJointNode != nullptr ? PlayingJointNode->GetNodeTableIndex() : INDEX_NONE;
 
-		for (UJointNodeBase* Node : JointManager->Nodes)
+	//The look-ahead follows the static edges of the graph instead of SelectNextNodes(), since selecting the next nodes can run the node logic and change its state.
+	if (NodeReplicationLookAhead > 0 && NodeTable.Nodes.IsValidIndex(PlayingNodeIndex) && NodeTable.Nodes[PlayingNodeIndex] == PlayingJointNode)
+	{
+		// The edges are computed once per asset - the duplicates share the node table layout of the asset they have been duplicated from.
+		const UJointManager* LayoutSource = SourceJointManager != nullptr && SourceJointManager->GetNodeTable().HasSameLayoutAs(NodeTable)
+			? SourceJointManager.Get()
+			: JointManager.Get();
+
+		TArray<int32> Frontier;
+		Frontier.Add(PlayingNodeIndex);
+
+		TSet<int32> VisitedBaseNodeIndices;
+		VisitedBaseNodeIndices.Add(PlayingNodeIndex);
+
+		for (int32 Step = 0; Step < NodeReplicationLookAhead && !Frontier.IsEmpty(); ++Step)
 		{
-			if (IsValid(Node))
+			TArray<int32> NextFrontier;
+
+			for (const int32 FrontierIndex : Frontier)
 			{
-				if (Node->bReplicates)
+				for (const int32 NextIndex : LayoutSource->GetStaticNextBaseNodeTableIndices(FrontierIndex))
 				{
-					Nodes.Add(Node);
-				}
+					if (!NodeTable.Nodes.IsValidIndex(NextIndex) || !IsValid(NodeTable.Nodes[NextIndex])) continue;
 
-				for (UJointNodeBase* SubNodes : Node->GetAllFragmentsOnLowerHierarchy())
-				{
-					if (IsValid(SubNodes))
-					{
-						if (SubNodes->bReplicates)
-						{
-							Nodes.Add(SubNodes);
-						}
-					}
+					bool bIsAlreadyVisited = false;
+					VisitedBaseNodeIndices.Add(NextIndex, &bIsAlreadyVisited);
+
+					if (bIsAlreadyVisited) continue;
+
+					CollectReplicatedNodeHierarchy(NodeTable.Nodes[NextIndex], NewLookAheadNodes);
+
+					NextFrontier.Add(NextIndex);
 				}
 			}
+
+			Frontier = MoveTemp(NextFrontier);
 		}
+	}
+
+	const TSet<UJointNodeBase*> NewLookAheadNodeSet(NewLookAheadNodes);
+
+	for (UJointNodeBase* OldNode : LookAheadNodesForNetworking)
+	{
+		if (!IsValid(OldNode) || NewLookAheadNodeSet.Contains(OldNode)) continue;
+
+		//Still active - it will be removed on its end play.
+		if (KnownActiveNodes.Contains(OldNode)) continue;
+
+		RemoveNodeForNetworking(OldNode);
+	}
+
+	for (UJointNodeBase* NewNode : NewLookAheadNodes)
+	{
+		AddNodeForNetworking(NewNode);
+	}
+
+	LookAheadNodesForNetworking = NewLookAheadNodes;
+}
+
+bool AJointActor::ShouldKeepInactiveNodeForNetworking(const UJointNodeBase* InNode) const
+{
+	//Manager fragments stay on the list for the whole Joint, and the upcoming nodes stay until the look-ahead moves on.
+	return JointManager->ManagerFragments.Contains(InNode) || LookAheadNodesForNetworking.Contains(InNode);
+}
+
+void AJointActor::FlushEndedNodesForNetworking()
+{
+	if (EndedNodesPendingNetworkingRemoval.IsEmpty() && EndedNodesReadyForNetworkingRemoval.IsEmpty()) return;
+
+	if (JointManager == nullptr || bIsUsingSharedJointManager)
+	{
+		EndedNodesPendingNetworkingRemoval.Empty();
+		EndedNodesReadyForNetworkingRemoval.Empty();
+
+		return;
+	}
+
+	//These have already gone through a net update after their end play.
+	for (UJointNodeBase* EndedNode : EndedNodesReadyForNetworkingRemoval)
+	{
+		if (!IsValid(EndedNode) || KnownActiveNodes.Contains(EndedNode) || ShouldKeepInactiveNodeForNetworking(EndedNode)) continue;
+
+		RemoveNodeForNetworking(EndedNode);
+	}
+
+	//The nodes that have ended since the last net update are sent with this one, and removed on the next.
+	EndedNodesReadyForNetworkingRemoval = MoveTemp(EndedNodesPendingNetworkingRemoval);
+
+	EndedNodesPendingNetworkingRemoval.Reset();
+}
+
+void AJointActor::CollectReplicatedNodeHierarchy(UJointNodeBase* InNode, TArray<UJointNodeBase*>& OutNodes)
+{
+	if (!IsValid(InNode)) return;
+
+	if (InNode->GetReplicates()) OutNodes.AddUnique(InNode);
+
+	for (UJointNodeBase* SubNode : InNode->SubNodes)
+	{
+		//Only the fragments are taken from the sub hierarchy. (See UJointManager::GetReplicatedNodeTableIndices())
+		if (SubNode && SubNode->IsA<UJointFragment>()) CollectReplicatedNodeHierarchy(SubNode, OutNodes);
+	}
+}
+
+void AJointActor::ApplyNodesForNetworking(const TArray<UJointNodeBase*>& NewNodes)
+{
+	const TSet<UJointNodeBase*> NewNodeSet(NewNodes);
 
-		CachedNodesForNetworking = Nodes;
-		
 #if USE_NEW_REPLICATION
-		
-		// This must be called after the caching
-		
-		for (UJointNodeBase* AllNodesForNetworking : CachedNodesForNetworking)
-		{
-			if(IsValid(AllNodesForNetworking))
-			{
-				AddReplicatedSubObject(AllNodesForNetworking);
-			}
-		}
 
-#endif
-		
+	TSet<UJointNodeBase*> OldNodeSet;
+
+	OldNodeSet.Reserve(CachedNodesForNetworking.Num());
+
+	for (UJointNodeBase* OldNode : CachedNodesForNetworking)
+	{
+		OldNodeSet.Add(OldNode);
+
+		if (IsValid(OldNode) && !NewNodeSet.Contains(OldNode)) RemoveReplicatedSubObject(OldNode);
 	}
+
+	for (UJointNodeBase* NewNode : NewNodes)
+	{
+		if (!OldNodeSet.Contains(NewNode)) AddReplicatedSubObject(NewNode);
+	}
+
+#endif
+
+	CachedNodesForNetworking = NewNodes;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AJointActor, CachedNodesForNetworking, this);
 }
 
 void AJointActor::AddNodeForNetworking(UJointNodeBase* InNode)
 {
 	if (HasAuthority())
 	{
-		if (JointManager == nullptr) return;
+		if (JointManager == nullptr || bIsUsingSharedJointManager) return;
 
 		if (InNode->GetHostingJointInstance() != this || InNode->GetJointManager() != this->GetJointManager())
 			return;
@@ -1072,6 +1576,8 @@ void AJointActor::AddNodeForNetworking(UJointNodeBase* InNode)
 #endif
 
 		CachedNodesForNetworking.Add(InNode);
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(AJointActor, CachedNodesForNetworking, this);
 	}
 }
 
@@ -1079,7 +1585,7 @@ void AJointActor::RemoveNodeForNetworking(UJointNodeBase* InNode)
 {
 	if (HasAuthority())
 	{
-		if (JointManager == nullptr) return;
+		if (JointManager == nullptr || bIsUsingSharedJointManager) return;
 
 		if (InNode->GetHostingJointInstance() != this || InNode->GetJointManager() != this->GetJointManager())
 			return;
@@ -1093,6 +1599,8 @@ void AJointActor::RemoveNodeForNetworking(UJointNodeBase* InNode)
 #endif
 
 		CachedNodesForNetworking.Remove(InNode);
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(AJointActor, CachedNodesForNetworking, this);
 	}
 }
 
@@ -1111,3 +1619,9 @@ void AJointActor::RemoveNodeForNetworking(UJointNodeBase* InNode)
 #undef DEBUG_ShowReplication
 
 #undef USE_NEW_REPLICATION
+
+
+AJointActor_Lightweight::AJointActor_Lightweight(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.DoNotCreateDefaultSubobject(AJointActor::AbilitySystemComponentName))
+{
+}
@@ -245,6 +245,23 @@ UJointNodeBase* UJointFunctionLibrary::GetCorrespondingJointNodeForJointManager(
 		if (JointManager == TargetManager) return SearchFor;
 
 		if (!TargetManager) return nullptr;
+
+		// The runtime duplicates of a Joint manager have the same node table layout as the asset, so the node table index of the node points the corresponding node directly.
+		// Make sure the index of the provided node is up to date with its own Joint manager first.
+		JointManager->GetNodeTable();
+
+		const int32 NodeTableIndex = SearchFor->GetNodeTableIndex();
+
+		const FJointManagerNodeTable& TargetNodeTable = TargetManager->GetNodeTable();
+
+		if (TargetNodeTable.Nodes.IsValidIndex(NodeTableIndex))
+		{
+			UJointNodeBase* Candidate = TargetNodeTable.Nodes[NodeTableIndex];
+
+			if (Candidate->GetNodeGuid() == SearchFor->GetNodeGuid() && Candidate->GetClass() == SearchFor->GetClass()) return Candidate;
+		}
+
+		// Fallback for the managers that don't share the same layout. (ex, the asset has been edited after the duplication)
 		
 		// JointManager->Nodes contains only the base node on the graph, not sub nodes. So we need to iterate through all nodes to find the matching one - but in a clever way.
 		// Cache the hierarchy paths of the provided node of the attachment tree, from base node to itself.
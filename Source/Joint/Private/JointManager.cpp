@@ -10,6 +10,7 @@
 #include "Node/JointNodeBase.h"
 #include "UObject/ObjectSaveContext.h"
 #include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
 
 UJointManager::UJointManager()
 {
@@ -24,48 +25,211 @@ void UJointManager::BeginDestroy()
 AJointActor* UJointManager::GetHostingJointActor() const
 {
 	// cast outer to Joint actor
-	return GetOuter() ? Cast<AJointActor>(GetOuter()) : nullptr;
+	if (AJointActor* OuterActor = GetOuter() ? Cast<AJointActor>(GetOuter()) : nullptr) return OuterActor;
+
+	// The asset itself can be played by the Joint actors with the shared instancing policy. Return the one that is executing it at the moment.
+	AJointActor* Context = AJointActor::GetSharedExecutionContext();
+	
+	return Context && Context->GetJointManager() == this ? Context : nullptr;
 }
 
-UJointNodeBase* UJointManager::FindBaseNodeWithGuid(FGuid NodeGuid) const
+void FJointManagerNodeTable::Reset()
 {
-	for (UJointNodeBase* Node : Nodes)
+	Nodes.Reset();
+	ParentIndices.Reset();
+	NumManagerFragmentEntries = 0;
+	BaseNodeGuidToIndex.Reset();
+	FragmentGuidToIndex.Reset();
+	LayoutHash = 0;
+}
+
+void FJointManagerNodeTable::Build(const UJointManager* InJointManager)
+{
+	Reset();
+
+	if (InJointManager == nullptr) return;
+
+	for (UJointNodeBase* ManagerFragment : InJointManager->ManagerFragments)
+	{
+		if (ManagerFragment == nullptr) continue;
+
+		AddEntry(ManagerFragment, INDEX_NONE, false);
+	}
+
+	NumManagerFragmentEntries = Nodes.Num();
+
+	for (UJointNodeBase* Node : InJointManager->Nodes)
 	{
 		if (Node == nullptr) continue;
 
-		if (Node->GetNodeGuid() == NodeGuid) return Node;
+		AddEntry(Node, INDEX_NONE, true);
 	}
+}
 
-	return nullptr;
+void FJointManagerNodeTable::AddEntry(UJointNodeBase* InNode, const int32 ParentIndex, const bool bIsBaseNode)
+{
+	const int32 Index = Nodes.Add(InNode);
+
+	ParentIndices.Add(ParentIndex);
+
+	LayoutHash = HashCombine(LayoutHash, GetTypeHash(InNode->GetClass()));
+	LayoutHash = HashCombine(LayoutHash, GetTypeHash(InNode->GetNodeGuid()));
+	LayoutHash = HashCombine(LayoutHash, GetTypeHash(ParentIndex));
+
+	InNode->NodeTableIndex = Index;
+
+	if (bIsBaseNode)
+	{
+		if (!BaseNodeGuidToIndex.Contains(InNode->GetNodeGuid())) BaseNodeGuidToIndex.Add(InNode->GetNodeGuid(), Index);
+	}
+	else if (InNode->IsA<UJointFragment>())
+	{
+		if (!FragmentGuidToIndex.Contains(InNode->GetNodeGuid())) FragmentGuidToIndex.Add(InNode->GetNodeGuid(), Index);
+	}
+
+	for (UJointNodeBase* SubNode : InNode->SubNodes)
+	{
+		if (SubNode == nullptr) continue;
+
+		AddEntry(SubNode, Index, false);
+	}
 }
 
+const FJointManagerNodeTable& UJointManager::GetNodeTable() const
+{
+	if (bIsNodeTableDirty)
+	{
+		NodeTable.Build(this);
 
-UJointFragment* UJointManager::FindFragmentWithGuid(FGuid NodeGuid) const
+		bIsNodeTableDirty = false;
+
+		bIsReplicatedNodeTableIndicesDirty = true;
+		bIsStaticNextBaseNodeTableIndicesDirty = true;
+	}
+
+	return NodeTable;
+}
+
+const TArray<int32>& UJointManager::GetReplicatedNodeTableIndices() const
 {
-	TArray<UJointFragment*> AllManagerFragments = GetAllManagerFragmentsOnLowerHierarchy();
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-	for (UJointFragment* ManagerFragment : AllManagerFragments)
+	if (bIsReplicatedNodeTableIndicesDirty)
 	{
-		if (ManagerFragment == nullptr) continue;
+		ReplicatedNodeTableIndices.Reset();
 
-		if (ManagerFragment->GetNodeGuid() == NodeGuid) return ManagerFragment;
+		for (int32 Index = 0; Index < Table.Num(); ++Index)
+		{
+			const UJointNodeBase* Node = Table.Nodes[Index];
+
+			if (!Node->GetReplicates()) continue;
+
+			// Base nodes replicate regardless of their type, but only the fragments are taken from the rest of the hierarchy.
+			const bool bIsBaseNode = !Table.IsManagerFragmentEntry(Index) && Table.IsRootEntry(Index);
+
+			if (bIsBaseNode || Node->IsA<UJointFragment>()) ReplicatedNodeTableIndices.Add(Index);
+		}
+
+		bIsReplicatedNodeTableIndicesDirty = false;
 	}
 
-	for (UJointNodeBase* Node : Nodes)
+	return ReplicatedNodeTableIndices;
+}
+
+void UJointManager::MarkNodeTableDirty()
+{
+	bIsNodeTableDirty = true;
+	bIsReplicatedNodeTableIndicesDirty = true;
+	bIsStaticNextBaseNodeTableIndicesDirty = true;
+}
+
+const TArray<int32>& UJointManager::GetStaticNextBaseNodeTableIndices(const int32 BaseNodeIndex) const
+{
+	//Rebuilds the table first if needed, which marks the edges as dirty as well.
+	GetNodeTable();
+
+	if (bIsStaticNextBaseNodeTableIndicesDirty)
 	{
-		if (Node == nullptr) continue;
+		BuildStaticNextBaseNodeTableIndices();
+
+		bIsStaticNextBaseNodeTableIndicesDirty = false;
+	}
+
+	static const TArray<int32> EmptyIndices;
+
+	const TArray<int32>* FoundIndices = StaticNextBaseNodeTableIndices.Find(BaseNodeIndex);
+
+	return FoundIndices ? *FoundIndices : EmptyIndices;
+}
+
+void UJointManager::BuildStaticNextBaseNodeTableIndices() const
+{
+	StaticNextBaseNodeTableIndices.Reset();
+
+	const FJointManagerNodeTable& Table = NodeTable;
+
+	for (int32 Index = Table.NumManagerFragmentEntries; Index < Table.Num(); ++Index)
+	{
+		//Find the base node that owns this entry.
+		int32 BaseNodeIndex = Index;
 
-		TArray<UJointFragment*> SubNodes = Node->GetAllFragmentsOnLowerHierarchy();
+		while (!Table.IsRootEntry(BaseNodeIndex)) BaseNodeIndex = Table.ParentIndices[BaseNodeIndex];
 
-		for (UJointFragment* SubNode : SubNodes)
+		const UJointNodeBase* Node = Table.Nodes[Index];
+
+		for (FPropertyValueIterator It(FObjectPropertyBase::StaticClass(), Node->GetClass(), Node); It; ++It)
 		{
-			if (SubNode == nullptr) continue;
+			const FObjectPropertyBase* Property = CastFieldChecked<FObjectPropertyBase>(It.Key());
+
+			//Transient references are runtime state, not a part of the graph.
+			if (Property->HasAnyPropertyFlags(CPF_Transient)) continue;
+
+			if (Property->PropertyClass == nullptr || !Property->PropertyClass->IsChildOf(UJointNodeBase::StaticClass())) continue;
+
+			//Soft references are taken only when they are already loaded - the nodes of this manager always are.
+			const UJointNodeBase* ReferencedNode = Cast<UJointNodeBase>(Property->GetObjectPropertyValue(It.Value()));
+
+			if (ReferencedNode == nullptr) continue;
+
+			const int32 ReferencedIndex = ReferencedNode->GetNodeTableIndex();
+
+			if (!Table.Nodes.IsValidIndex(ReferencedIndex) || Table.Nodes[ReferencedIndex] != ReferencedNode) continue;
 
-			if (SubNode->GetNodeGuid() == NodeGuid) return SubNode;
+			//Only the base nodes can be played next.
+			if (Table.IsManagerFragmentEntry(ReferencedIndex) || !Table.IsRootEntry(ReferencedIndex)) continue;
+
+			if (ReferencedIndex == BaseNodeIndex) continue;
+
+			StaticNextBaseNodeTableIndices.FindOrAdd(BaseNodeIndex).AddUnique(ReferencedIndex);
 		}
 	}
+}
 
-	return nullptr;
+void UJointManager::BuildFragmentIndices()
+{
+	for (UJointNodeBase* Node : GetNodeTable().Nodes)
+	{
+		Node->BuildFragmentIndexIfDirty();
+	}
+}
+
+UJointNodeBase* UJointManager::FindBaseNodeWithGuid(FGuid NodeGuid) const
+{
+	const FJointManagerNodeTable& Table = GetNodeTable();
+
+	const int32* Index = Table.BaseNodeGuidToIndex.Find(NodeGuid);
+
+	return Index ? Table.Nodes[*Index] : nullptr;
+}
+
+
+UJointFragment* UJointManager::FindFragmentWithGuid(FGuid NodeGuid) const
+{
+	const FJointManagerNodeTable& Table = GetNodeTable();
+
+	const int32* Index = Table.FragmentGuidToIndex.Find(NodeGuid);
+
+	return Index ? Cast<UJointFragment>(Table.Nodes[*Index]) : nullptr;
 }
 
 UJointFragment* UJointManager::FindManagerFragmentByClass(TSubclassOf<UJointFragment> FragmentClass) const
@@ -117,16 +281,23 @@ const TArray<UJointFragment*> UJointManager::GetAllManagerFragments() const
 UJointFragment* UJointManager::FindManagerFragmentByClassOnLowerHierarchy(
 	TSubclassOf<UJointFragment> FragmentClass) const
 {
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
+	const FJointManagerNodeTable& Table = GetNodeTable();
+
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
 	{
-		if(!ManagerFragment) continue;
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
+		if (Fragment == nullptr) continue;
+
+		//The manager fragments themselves are only returned when the class is specified.
+		if (FragmentClass == nullptr)
+		{
+			if (!Table.IsRootEntry(Index)) return Fragment;
+		}
+		else if (Fragment->GetClass() == FragmentClass)
 		{
-			if (FragmentClass != nullptr && CastedManagerFragment->GetClass() == FragmentClass) return CastedManagerFragment; //It intentionally returns nothing.
+			return Fragment;
 		}
-		
-		if (UJointFragment* FoundNode = UJointNodeBase::IterateAndGetTheFirstFragmentForClassUnderNode(ManagerFragment, FragmentClass)) return FoundNode;
 	}
 
 	return nullptr;
@@ -137,23 +308,15 @@ const TArray<UJointFragment*> UJointManager::FindManagerFragmentsByClassOnLowerH
 {
 	TArray<UJointFragment*> Fragments;
 
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
+	const FJointManagerNodeTable& Table = GetNodeTable();
+
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
 	{
-		if(!ManagerFragment) continue;
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			if (FragmentClass != nullptr)
-			{
-				if (CastedManagerFragment->GetClass() == FragmentClass) Fragments.Add(CastedManagerFragment);
-			}
-			else
-			{
-				Fragments.Add(CastedManagerFragment);
-			}
-		}
-		
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, Fragments, FragmentClass);
+		if (Fragment == nullptr) continue;
+
+		if (FragmentClass == nullptr || Fragment->GetClass() == FragmentClass) Fragments.Add(Fragment);
 	}
 
 	return Fragments;
@@ -163,16 +326,13 @@ const TArray<UJointFragment*> UJointManager::GetAllManagerFragmentsOnLowerHierar
 {
 	TArray<UJointFragment*> Fragments;
 
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			Fragments.Add(CastedManagerFragment);
-		}
-		
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, Fragments, nullptr);
+	Fragments.Reserve(Table.NumManagerFragmentEntries);
+
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		if (UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index])) Fragments.Add(Fragment);
 	}
 
 	return Fragments;
@@ -181,26 +341,15 @@ const TArray<UJointFragment*> UJointManager::GetAllManagerFragmentsOnLowerHierar
 UJointFragment* UJointManager::FindManagerFragmentWithTagOnLowerHierarchy(FGameplayTag InNodeTag,
 	const bool bExact)
 {
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		TArray<UJointFragment*> IterFragments;
-
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
-		
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
+		if (Fragment == nullptr) continue;
 
-			if (bExact ? IterFragment->NodeTags.HasTagExact(InNodeTag) : IterFragment->NodeTags.HasTag(InNodeTag))
-				return IterFragment;
-		}
+		if (bExact ? Fragment->NodeTags.HasTagExact(InNodeTag) : Fragment->NodeTags.HasTag(InNodeTag)) return Fragment;
 	}
 
 	return nullptr;
@@ -209,28 +358,17 @@ UJointFragment* UJointManager::FindManagerFragmentWithTagOnLowerHierarchy(FGamep
 TArray<UJointFragment*> UJointManager::FindManagerFragmentsWithTagOnLowerHierarchy(FGameplayTag InNodeTag,
 	const bool bExact)
 {
-
 	TArray<UJointFragment*> OutFragments;
-	
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
 
-		TArray<UJointFragment*> IterFragments;
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
-		
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
+		if (Fragment == nullptr) continue;
 
-			if (bExact ? IterFragment->NodeTags.HasTagExact(InNodeTag) : IterFragment->NodeTags.HasTag(InNodeTag)) OutFragments.Add(IterFragment);
-		}
+		if (bExact ? Fragment->NodeTags.HasTagExact(InNodeTag) : Fragment->NodeTags.HasTag(InNodeTag)) OutFragments.Add(Fragment);
 	}
 
 	return OutFragments;
@@ -239,27 +377,17 @@ TArray<UJointFragment*> UJointManager::FindManagerFragmentsWithTagOnLowerHierarc
 UJointFragment* UJointManager::FindManagerFragmentWithAnyTagsOnLowerHierarchy(
 	FGameplayTagContainer InNodeTagContainer, const bool bExact)
 {
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
-
-		TArray<UJointFragment*> IterFragments;
-
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
+		if (Fragment == nullptr) continue;
 
-			if (bExact
-				    ? IterFragment->NodeTags.HasAnyExact(InNodeTagContainer)
-				    : IterFragment->NodeTags.HasAny(InNodeTagContainer)) return IterFragment;
-		}
+		if (bExact
+			    ? Fragment->NodeTags.HasAnyExact(InNodeTagContainer)
+			    : Fragment->NodeTags.HasAny(InNodeTagContainer)) return Fragment;
 	}
 
 	return nullptr;
@@ -270,27 +398,17 @@ TArray<UJointFragment*> UJointManager::FindManagerFragmentsWithAnyTagsOnLowerHie
 {
 	TArray<UJointFragment*> OutFragments;
 
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		TArray<UJointFragment*> IterFragments;
-
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
-
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
+		if (Fragment == nullptr) continue;
 
-			if (bExact
-					? IterFragment->NodeTags.HasAnyExact(InNodeTagContainer)
-					: IterFragment->NodeTags.HasAny(InNodeTagContainer)) OutFragments.Add(IterFragment);
-		}
+		if (bExact
+			    ? Fragment->NodeTags.HasAnyExact(InNodeTagContainer)
+			    : Fragment->NodeTags.HasAny(InNodeTagContainer)) OutFragments.Add(Fragment);
 	}
 
 	return OutFragments;
@@ -299,27 +417,17 @@ TArray<UJointFragment*> UJointManager::FindManagerFragmentsWithAnyTagsOnLowerHie
 UJointFragment* UJointManager::FindManagerFragmentWithAllTagsOnLowerHierarchy(
 	FGameplayTagContainer InNodeTagContainer, const bool bExact)
 {
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
-
-		TArray<UJointFragment*> IterFragments;
-
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
+		if (Fragment == nullptr) continue;
 
-			if (bExact
-				    ? IterFragment->NodeTags.HasAll(InNodeTagContainer)
-				    : IterFragment->NodeTags.HasAllExact(InNodeTagContainer)) return IterFragment;
-		}
+		if (bExact
+			    ? Fragment->NodeTags.HasAllExact(InNodeTagContainer)
+			    : Fragment->NodeTags.HasAll(InNodeTagContainer)) return Fragment;
 	}
 
 	return nullptr;
@@ -328,30 +436,19 @@ UJointFragment* UJointManager::FindManagerFragmentWithAllTagsOnLowerHierarchy(
 TArray<UJointFragment*> UJointManager::FindManagerFragmentsWithAllTagsOnLowerHierarchy(
 	FGameplayTagContainer InNodeTagContainer, const bool bExact)
 {
-
 	TArray<UJointFragment*> OutFragments;
-	
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
-
-		TArray<UJointFragment*> IterFragments;
 
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	for (int32 Index = 0; Index < Table.NumManagerFragmentEntries; ++Index)
+	{
+		UJointFragment* Fragment = Cast<UJointFragment>(Table.Nodes[Index]);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
+		if (Fragment == nullptr) continue;
 
-			if (bExact
-					? IterFragment->NodeTags.HasAll(InNodeTagContainer)
-					: IterFragment->NodeTags.HasAllExact(InNodeTagContainer)) OutFragments.Add(IterFragment);
-		}
+		if (bExact
+			    ? Fragment->NodeTags.HasAllExact(InNodeTagContainer)
+			    : Fragment->NodeTags.HasAll(InNodeTagContainer)) OutFragments.Add(Fragment);
 	}
 
 	return OutFragments;
@@ -359,28 +456,12 @@ TArray<UJointFragment*> UJointManager::FindManagerFragmentsWithAllTagsOnLowerHie
 
 UJointFragment* UJointManager::FindManagerFragmentWithGuidOnLowerHierarchy(const FGuid Guid) const
 {
-	for (UJointNodeBase* ManagerFragment : ManagerFragments)
-	{
-		if(!ManagerFragment) continue;
-
-		TArray<UJointFragment*> IterFragments;
-
-		if(UJointFragment* CastedManagerFragment = Cast<UJointFragment>(ManagerFragment))
-		{
-			IterFragments.Add(CastedManagerFragment);
-		}
+	const FJointManagerNodeTable& Table = GetNodeTable();
 
-		UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(ManagerFragment, IterFragments, nullptr);
+	//The manager fragments' hierarchy comes first on the table, so the first recorded fragment for the guid is the one we are looking for if there is any.
+	const int32* Index = Table.FragmentGuidToIndex.Find(Guid);
 
-		for (UJointFragment* IterFragment : IterFragments)
-		{
-			if (IterFragment == nullptr) continue;
-
-			if (IterFragment->GetNodeGuid() == Guid) return IterFragment;
-		}
-	}
-
-	return nullptr;
+	return Index && Table.IsManagerFragmentEntry(*Index) ? Cast<UJointFragment>(Table.Nodes[*Index]) : nullptr;
 }
 
 UJointFragment* UJointManager::FindManagerFragmentWithTag(FGameplayTag InNodeTag, const bool bExact)
@@ -524,6 +605,8 @@ void UJointManager::PostEditChangeProperty(struct FPropertyChangedEvent& Propert
 
 	ensure(this);
 
+	MarkNodeTableDirty();
+
 	this->MarkPackageDirty();
 
 	this->GetOuter()->MarkPackageDirty();
@@ -577,3 +660,64 @@ void UJointManager::Serialize(FArchive& Ar)
 	UObject::Serialize(Ar);
 	
 }
+
+void UJointManager::PostLoad()
+{
+	UObject::PostLoad();
+
+	MarkNodeTableDirty();
+
+	GetNodeTable();
+}
+
+void UJointManager::PostDuplicate(bool bDuplicateForPIE)
+{
+	UObject::PostDuplicate(bDuplicateForPIE);
+
+	MarkNodeTableDirty();
+
+	GetNodeTable();
+}
+
+void UJointManager::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	UObject::PreSave(ObjectSaveContext);
+
+	// Make sure the saved (and cooked) node table indices match the current layout of the nodes.
+	MarkNodeTableDirty();
+
+	GetNodeTable();
+}
+
+#if WITH_EDITORONLY_DATA
+
+const FName UJointManager::NodeClassReferencesTagName = TEXT("JointNodeClassReferences");
+const FName UJointManager::EditorNodeClassReferencesTagName = TEXT("JointEditorNodeClassReferences");
+const FName UJointManager::ClassReferencesVersionTagName = TEXT("JointClassReferencesVersion");
+const TCHAR* UJointManager::ClassReferencesTagSeparator = TEXT(";");
+
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+
+void UJointManager::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	UObject::GetAssetRegistryTags(OutTags);
+
+	OutTags.Add(FAssetRegistryTag(ClassReferencesVersionTagName, TEXT("1"), FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(FAssetRegistryTag(NodeClassReferencesTagName, FString::Join(NodeClassReferences, ClassReferencesTagSeparator), FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(FAssetRegistryTag(EditorNodeClassReferencesTagName, FString::Join(EditorNodeClassReferences, ClassReferencesTagSeparator), FAssetRegistryTag::TT_Hidden));
+}
+
+#else
+
+void UJointManager::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	UObject::GetAssetRegistryTags(Context);
+
+	Context.AddTag(FAssetRegistryTag(ClassReferencesVersionTagName, TEXT("1"), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(NodeClassReferencesTagName, FString::Join(NodeClassReferences, ClassReferencesTagSeparator), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag(EditorNodeClassReferencesTagName, FString::Join(EditorNodeClassReferences, ClassReferencesTagSeparator), FAssetRegistryTag::TT_Hidden));
+}
+
+#endif
+
+#endif
@@ -118,6 +118,11 @@ const FGuid& UJointNodeBase::GetNodeGuid() const
 	return NodeGuid;
 }
 
+int32 UJointNodeBase::GetNodeTableIndex() const
+{
+	return NodeTableIndex;
+}
+
 void UJointNodeBase::GetOwnedGameplayTags(FGameplayTagContainer& TagContainer) const
 {
 	TagContainer = NodeTags;
@@ -340,6 +345,20 @@ void UJointNodeBase::OnCompileNode_Implementation(TArray<FJointEdLogMessage>& Lo
 {
 }
 
+#if WITH_EDITOR
+
+bool UJointNodeBase::IsCompileResultDependentOnGraph() const
+{
+	if (bIsCompileResultLocalToNode) return false;
+
+	//A Blueprint override of OnCompileNode() can look at anything in the graph.
+	const UFunction* CompileFunction = GetClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UJointNodeBase, OnCompileNode));
+
+	return CompileFunction != nullptr && CompileFunction->GetOuter() != UJointNodeBase::StaticClass();
+}
+
+#endif
+
 UJointFragment* UJointNodeBase::IterateAndGetTheFirstFragmentForClassUnderNode(
 	UJointNodeBase* NodeToCollect,
 	TSubclassOf<UJointFragment> SpecificClassToFind)
@@ -370,20 +389,220 @@ UJointFragment* UJointNodeBase::IterateAndGetTheFirstFragmentForClassUnderNode(
 }
 
 
-UJointFragment* UJointNodeBase::FindFragmentWithTagOnLowerHierarchy(
-	const FGameplayTag InNodeTag, const bool bExact)
+void FJointFragmentIndex::Reset()
 {
-	TArray<UJointFragment*> Fragments;
+	Fragments.Reset();
+	GuidToIndex.Reset();
+	ClassToIndices.Reset();
+	ExactTagToIndices.Reset();
+	TagToIndices.Reset();
+	TagHashes.Reset();
+}
+
+void FJointFragmentIndex::Build(UJointNodeBase* InNode)
+{
+	Reset();
+
+	UJointNodeBase::IterateAndCollectAllFragmentsUnderNode(InNode, Fragments, nullptr);
+
+	TagHashes.Reserve(Fragments.Num());
+
+	for (int32 Index = 0; Index < Fragments.Num(); ++Index)
+	{
+		const UJointFragment* Fragment = Fragments[Index];
+
+		TagHashes.Add(HashTags(Fragment->NodeTags));
+
+		if (!GuidToIndex.Contains(Fragment->GetNodeGuid())) GuidToIndex.Add(Fragment->GetNodeGuid(), Index);
+
+		for (const UClass* Class = Fragment->GetClass(); Class != nullptr; Class = Class->GetSuperClass())
+		{
+			ClassToIndices.FindOrAdd(Class).Add(Index);
+
+			if (Class == UJointFragment::StaticClass()) break;
+		}
+
+		for (const FGameplayTag& Tag : Fragment->NodeTags)
+		{
+			TArray<int32>& ExactIndices = ExactTagToIndices.FindOrAdd(Tag);
+
+			if (ExactIndices.IsEmpty() || ExactIndices.Last() != Index) ExactIndices.Add(Index);
+
+			//GetGameplayTagParents() contains the tag itself as well.
+			for (const FGameplayTag& ParentTag : Tag.GetGameplayTagParents())
+			{
+				TArray<int32>& Indices = TagToIndices.FindOrAdd(ParentTag);
+
+				if (Indices.IsEmpty() || Indices.Last() != Index) Indices.Add(Index);
+			}
+		}
+	}
+}
+
+bool FJointFragmentIndex::HasStaleTags() const
+{
+	for (int32 Index = 0; Index < Fragments.Num(); ++Index)
+	{
+		if (Fragments[Index] == nullptr || HashTags(Fragments[Index]->NodeTags) != TagHashes[Index]) return true;
+	}
+
+	return false;
+}
+
+uint32 FJointFragmentIndex::HashTags(const FGameplayTagContainer& InTags)
+{
+	uint32 Hash = GetTypeHash(InTags.Num());
+
+	for (const FGameplayTag& Tag : InTags) Hash = HashCombine(Hash, GetTypeHash(Tag));
+
+	return Hash;
+}
+
+const TArray<int32>* FJointFragmentIndex::FindTagIndices(const FGameplayTag& InTag, const bool bExact) const
+{
+	return bExact ? ExactTagToIndices.Find(InTag) : TagToIndices.Find(InTag);
+}
+
+const TArray<int32>* FJointFragmentIndex::FindClassIndices(const UClass* InClass) const
+{
+	return ClassToIndices.Find(InClass);
+}
+
+UJointFragment* FJointFragmentIndex::FindFragmentWithGuid(const FGuid& InGuid) const
+{
+	const int32* Index = GuidToIndex.Find(InGuid);
+
+	return Index ? Fragments[*Index] : nullptr;
+}
+
+void FJointFragmentIndex::CollectIndicesWithAnyTags(const FGameplayTagContainer& InTagContainer, const bool bExact,
+                                                    TArray<int32>& OutIndices, const bool bFirstOnly) const
+{
+	if (bFirstOnly)
+	{
+		int32 FirstIndex = INDEX_NONE;
+
+		for (const FGameplayTag& Tag : InTagContainer)
+		{
+			if (const TArray<int32>* Indices = FindTagIndices(Tag, bExact))
+			{
+				if (FirstIndex == INDEX_NONE || (*Indices)[0] < FirstIndex) FirstIndex = (*Indices)[0];
+			}
+		}
+
+		if (FirstIndex != INDEX_NONE) OutIndices.Add(FirstIndex);
+
+		return;
+	}
+
+	//Merge the lists while keeping the hierarchy order.
+	TBitArray<> MatchedIndices(false, Fragments.Num());
 
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
+	for (const FGameplayTag& Tag : InTagContainer)
+	{
+		if (const TArray<int32>* Indices = FindTagIndices(Tag, bExact))
+		{
+			for (const int32 Index : *Indices) MatchedIndices[Index] = true;
+		}
+	}
+
+	for (TConstSetBitIterator<> It(MatchedIndices); It; ++It) OutIndices.Add(It.GetIndex());
+}
 
-	for (UJointFragment* Fragment : Fragments)
+void FJointFragmentIndex::CollectIndicesWithAllTags(const FGameplayTagContainer& InTagContainer, const bool bExact,
+                                                    TArray<int32>& OutIndices, const bool bFirstOnly) const
+{
+	//Every fragment satisfies an empty container.
+	if (InTagContainer.IsEmpty())
 	{
-		if (Fragment == nullptr) continue;
+		for (int32 Index = 0; Index < Fragments.Num(); ++Index)
+		{
+			OutIndices.Add(Index);
 
-		if (bExact ? Fragment->NodeTags.HasTagExact(InNodeTag) : Fragment->NodeTags.HasTag(InNodeTag)) return Fragment;
+			if (bFirstOnly) return;
+		}
+
+		return;
 	}
 
+	//Use the shortest list as the candidates and check the rest of the tags on them.
+	const TArray<int32>* Candidates = nullptr;
+
+	for (const FGameplayTag& Tag : InTagContainer)
+	{
+		const TArray<int32>* Indices = FindTagIndices(Tag, bExact);
+
+		if (Indices == nullptr) return;
+
+		if (Candidates == nullptr || Indices->Num() < Candidates->Num()) Candidates = Indices;
+	}
+
+	for (const int32 Index : *Candidates)
+	{
+		const FGameplayTagContainer& NodeTags = Fragments[Index]->NodeTags;
+
+		if (bExact ? NodeTags.HasAllExact(InTagContainer) : NodeTags.HasAll(InTagContainer))
+		{
+			OutIndices.Add(Index);
+
+			if (bFirstOnly) return;
+		}
+	}
+}
+
+void UJointNodeBase::SetNodeTags(const FGameplayTagContainer& InNodeTags)
+{
+	NodeTags = InNodeTags;
+
+	MarkFragmentIndexDirty();
+}
+
+void UJointNodeBase::MarkFragmentIndexDirty()
+{
+	//The lower hierarchy of the parent nodes contains this node's lower hierarchy as well.
+	for (UJointNodeBase* Node = this; Node != nullptr; Node = Node->GetParentNode())
+	{
+		Node->bIsFragmentIndexDirty = true;
+	}
+
+	//The node table of the Joint manager is laid out from the same hierarchy.
+	if (UJointManager* Manager = GetJointManager()) Manager->MarkNodeTableDirty();
+}
+
+void UJointNodeBase::BuildFragmentIndexIfDirty()
+{
+	if (!bIsFragmentIndexDirty) return;
+
+	FragmentIndex.Build(this);
+
+	bIsFragmentIndexDirty = false;
+}
+
+const FJointFragmentIndex& UJointNodeBase::GetFragmentIndex()
+{
+	BuildFragmentIndexIfDirty();
+
+	return FragmentIndex;
+}
+
+const FJointFragmentIndex& UJointNodeBase::GetFragmentIndexForTagQuery()
+{
+	BuildFragmentIndexIfDirty();
+
+	//NodeTags can be written without marking the index as dirty. (ex, from the blueprints)
+	if (FragmentIndex.HasStaleTags()) FragmentIndex.Build(this);
+
+	return FragmentIndex;
+}
+
+
+UJointFragment* UJointNodeBase::FindFragmentWithTagOnLowerHierarchy(
+	const FGameplayTag InNodeTag, const bool bExact)
+{
+	const FJointFragmentIndex& Index = GetFragmentIndexForTagQuery();
+
+	if (const TArray<int32>* Indices = Index.FindTagIndices(InNodeTag, bExact)) return Index.Fragments[(*Indices)[0]];
+
 	return nullptr;
 }
 
@@ -392,17 +611,13 @@ TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithTagOnLowerHierarchy(
 {
 	TArray<UJointFragment*> OutFragments;
 
-	TArray<UJointFragment*> Fragments;
-
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
+	const FJointFragmentIndex& Index = GetFragmentIndexForTagQuery();
 
-	for (UJointFragment* Fragment : Fragments)
+	if (const TArray<int32>* Indices = Index.FindTagIndices(InNodeTag, bExact))
 	{
-		if (Fragment == nullptr) continue;
+		OutFragments.Reserve(Indices->Num());
 
-		if (bExact ? Fragment->NodeTags.HasTagExact(InNodeTag) : Fragment->NodeTags.HasTag(InNodeTag))
-			OutFragments.
-				Add(Fragment);
+		for (const int32 FragmentIndex : *Indices) OutFragments.Add(Index.Fragments[FragmentIndex]);
 	}
 
 	return OutFragments;
@@ -411,19 +626,13 @@ TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithTagOnLowerHierarchy(
 UJointFragment* UJointNodeBase::FindFragmentWithAnyTagsOnLowerHierarchy(
 	const FGameplayTagContainer InNodeTagContainer, const bool bExact)
 {
-	TArray<UJointFragment*> Fragments;
+	const FJointFragmentIndex& Index = GetFragmentIndexForTagQuery();
 
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
+	TArray<int32, TInlineAllocator<1>> Indices;
 
-	for (UJointFragment* Fragment : Fragments)
-	{
-		if (Fragment == nullptr) continue;
-
-		if (bExact ? Fragment->NodeTags.HasAnyExact(InNodeTagContainer) : Fragment->NodeTags.HasAny(InNodeTagContainer))
-			return Fragment;
-	}
+	Index.CollectIndicesWithAnyTags(InNodeTagContainer, bExact, Indices, true);
 
-	return nullptr;
+	return Indices.IsEmpty() ? nullptr : Index.Fragments[Indices[0]];
 }
 
 TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithAnyTagsOnLowerHierarchy(
@@ -431,17 +640,15 @@ TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithAnyTagsOnLowerHierarchy
 {
 	TArray<UJointFragment*> OutFragments;
 
-	TArray<UJointFragment*> Fragments;
+	const FJointFragmentIndex& Index = GetFragmentIndexForTagQuery();
 
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
+	TArray<int32> Indices;
 
-	for (UJointFragment* Fragment : Fragments)
-	{
-		if (Fragment == nullptr) continue;
+	Index.CollectIndicesWithAnyTags(InNodeTagContainer, bExact, Indices, false);
 
-		if (bExact ? Fragment->NodeTags.HasAnyExact(InNodeTagContainer) : Fragment->NodeTags.HasAny(InNodeTagContainer))
-			OutFragments.Add(Fragment);
-	}
+	OutFragments.Reserve(Indices.Num());
+
+	for (const int32 FragmentIndex : Indices) OutFragments.Add(Index.Fragments[FragmentIndex]);
 
 	return OutFragments;
 }
@@ -449,19 +656,13 @@ TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithAnyTagsOnLowerHierarchy
 UJointFragment* UJointNodeBase::FindFragmentWithAllTagsOnLowerHierarchy(
 	const FGameplayTagContainer InNodeTagContainer, const bool bExact)
 {
-	TArray<UJointFragment*> Fragments;
+	const FJointFragmentIndex& Index = GetFragmentIndexForTagQuery();
 
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
+	TArray<int32, TInlineAllocator<1>> Indices;
 
-	for (UJointFragment* Fragment : Fragments)
-	{
-		if (Fragment == nullptr) continue;
+	Index.CollectIndicesWithAllTags(InNodeTagContainer, bExact, Indices, true);
 
-		if (bExact ? Fragment->NodeTags.HasAllExact(InNodeTagContainer) : Fragment->NodeTags.HasAll(InNodeTagContainer))
-			return Fragment;
-	}
-
-	return nullptr;
+	return Indices.IsEmpty() ? nullptr : Index.Fragments[Indices[0]];
 }
 
 TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithAllTagsOnLowerHierarchy(
@@ -469,17 +670,15 @@ TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithAllTagsOnLowerHierarchy
 {
 	TArray<UJointFragment*> OutFragments;
 
-	TArray<UJointFragment*> Fragments;
+	const FJointFragmentIndex& Index = GetFragmentIndexForTagQuery();
 
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
+	TArray<int32> Indices;
 
-	for (UJointFragment* Fragment : Fragments)
-	{
-		if (Fragment == nullptr) continue;
+	Index.CollectIndicesWithAllTags(InNodeTagContainer, bExact, Indices, false);
 
-		if (bExact ? Fragment->NodeTags.HasAllExact(InNodeTagContainer) : Fragment->NodeTags.HasAll(InNodeTagContainer))
-			OutFragments.Add(Fragment);
-	}
+	OutFragments.Reserve(Indices.Num());
+
+	for (const int32 FragmentIndex : Indices) OutFragments.Add(Index.Fragments[FragmentIndex]);
 
 	return OutFragments;
 }
@@ -487,44 +686,52 @@ TArray<UJointFragment*> UJointNodeBase::FindFragmentsWithAllTagsOnLowerHierarchy
 
 UJointFragment* UJointNodeBase::FindFragmentWithGuidOnLowerHierarchy(FGuid InNodeGuid)
 {
-	TArray<UJointFragment*> Fragments;
-
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
-
-	for (UJointFragment* Fragment : Fragments)
-	{
-		if (Fragment == nullptr) continue;
-
-		if (Fragment->NodeGuid == InNodeGuid) return Fragment;
-	}
-
-	return nullptr;
+	return GetFragmentIndex().FindFragmentWithGuid(InNodeGuid);
 }
 
 
 UJointFragment* UJointNodeBase::FindFragmentByClassOnLowerHierarchy(
 	TSubclassOf<UJointFragment> FragmentClass)
 {
-	return IterateAndGetTheFirstFragmentForClassUnderNode(this, FragmentClass);
+	const FJointFragmentIndex& Index = GetFragmentIndex();
+
+	if (FragmentClass == nullptr) return Index.Fragments.IsEmpty() ? nullptr : Index.Fragments[0];
+
+	//The class table contains the subclasses as well, but this function only accepts the exact class.
+	if (const TArray<int32>* Indices = Index.FindClassIndices(FragmentClass))
+	{
+		for (const int32 FragmentIndex : *Indices)
+		{
+			if (Index.Fragments[FragmentIndex]->GetClass() == FragmentClass) return Index.Fragments[FragmentIndex];
+		}
+	}
+
+	return nullptr;
 }
 
 TArray<UJointFragment*> UJointNodeBase::FindFragmentsByClassOnLowerHierarchy(
 	TSubclassOf<UJointFragment> FragmentClass)
 {
+	const FJointFragmentIndex& Index = GetFragmentIndex();
+
+	if (FragmentClass == nullptr) return Index.Fragments;
+
 	TArray<UJointFragment*> Fragments;
 
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, FragmentClass);
+	if (const TArray<int32>* Indices = Index.FindClassIndices(FragmentClass))
+	{
+		for (const int32 FragmentIndex : *Indices)
+		{
+			if (Index.Fragments[FragmentIndex]->GetClass() == FragmentClass) Fragments.Add(Index.Fragments[FragmentIndex]);
+		}
+	}
 
 	return Fragments;
 }
 
 TArray<UJointFragment*> UJointNodeBase::GetAllFragmentsOnLowerHierarchy()
 {
-	TArray<UJointFragment*> Fragments;
-
-	IterateAndCollectAllFragmentsUnderNode(this, Fragments, nullptr);
-
-	return Fragments;
+	return GetFragmentIndex().Fragments;
 }
 
 UJointFragment* UJointNodeBase::FindFragmentWithTag(FGameplayTag InNodeTag, const bool bExact)
@@ -710,22 +917,172 @@ TArray<UJointNodeBase*> UJointNodeBase::SelectNextNodes_Implementation(
 
 bool UJointNodeBase::IsNodeBegunPlay() const
 {
+	if (const FJointNodeRuntimeState* State = nullptr; FindSharedRuntimeStateForRead(State))
+	{
+		return State && State->bIsNodeBegunPlay;
+	}
+	
 	return bIsNodeBegunPlay;
 }
 
 bool UJointNodeBase::IsNodeEndedPlay() const
 {
+	if (const FJointNodeRuntimeState* State = nullptr; FindSharedRuntimeStateForRead(State))
+	{
+		return State && State->bIsNodeEndedPlay;
+	}
+	
 	return bIsNodeEndedPlay;
 }
 
 bool UJointNodeBase::IsNodePending() const
 {
+	if (const FJointNodeRuntimeState* State = nullptr; FindSharedRuntimeStateForRead(State))
+	{
+		return State && State->bIsNodePending;
+	}
+	
+	return bIsNodePending;
+}
+
+bool UJointNodeBase::IsNodeBegunPlayFor(const AJointActor* JointActor) const
+{
+	if (JointActor && JointActor->IsUsingSharedJointManager() && JointActor->JointManager == GetJointManager())
+	{
+		const FJointNodeRuntimeState* State = JointActor->FindSharedNodeRuntimeState(this);
+
+		return State && State->bIsNodeBegunPlay;
+	}
+
+	return bIsNodeBegunPlay;
+}
+
+bool UJointNodeBase::IsNodeEndedPlayFor(const AJointActor* JointActor) const
+{
+	if (JointActor && JointActor->IsUsingSharedJointManager() && JointActor->JointManager == GetJointManager())
+	{
+		const FJointNodeRuntimeState* State = JointActor->FindSharedNodeRuntimeState(this);
+
+		return State && State->bIsNodeEndedPlay;
+	}
+
+	return bIsNodeEndedPlay;
+}
+
+bool UJointNodeBase::IsNodePendingFor(const AJointActor* JointActor) const
+{
+	if (JointActor && JointActor->IsUsingSharedJointManager() && JointActor->JointManager == GetJointManager())
+	{
+		const FJointNodeRuntimeState* State = JointActor->FindSharedNodeRuntimeState(this);
+
+		return State && State->bIsNodePending;
+	}
+
 	return bIsNodePending;
 }
 
+bool UJointNodeBase::IsNodeActiveFor(const AJointActor* JointActor) const
+{
+	return IsNodeBegunPlayFor(JointActor) && !IsNodeEndedPlayFor(JointActor);
+}
+
+bool UJointNodeBase::FindSharedRuntimeStateForRead(const FJointNodeRuntimeState*& OutState) const
+{
+	OutState = nullptr;
+
+	if (const AJointActor* Context = GetSharedExecutionContext())
+	{
+		OutState = Context->FindSharedNodeRuntimeState(this);
+
+		return true;
+	}
+
+	//Not in the middle of the execution - see if any Joint actor plays this node as a shared node.
+	AJointActor* Player = nullptr;
+
+	if (!FindSoleSharedPlayer(Player)) return false;
+
+	if (Player) OutState = Player->FindSharedNodeRuntimeState(this);
+
+	return true;
+}
+
+bool UJointNodeBase::FindSoleSharedPlayer(AJointActor*& OutPlayer) const
+{
+	const int32 NumPlayers = AJointActor::FindSharedJointManagerPlayers(GetJointManager(), OutPlayer);
+
+	if (NumPlayers == 0) return false;
+
+	if (NumPlayers == 1) return true;
+
+	OutPlayer = nullptr;
+
+	//The getters can be polled every frame - report it only once.
+	if (!bHasReportedAmbiguousSharedPlayers)
+	{
+		bHasReportedAmbiguousSharedPlayers = true;
+
+		UE_LOG(LogJoint, Warning, TEXT("Node %s is shared by several Joint actors and has been accessed outside of their execution, so its runtime state and its hosting Joint actor are ambiguous. Use IsNodeBegunPlayFor() / IsNodeActiveFor() and the request functions of the Joint actor you are interested in."),
+			*GetPathName());
+	}
+
+	return true;
+}
+
+AJointActor* UJointNodeBase::GetSharedExecutionContext() const
+{
+	AJointActor* Context = AJointActor::GetSharedExecutionContext();
+
+	// The context is only meaningful for the nodes of the asset that the context actor is playing.
+	if (Context == nullptr || Context->GetJointManager() != GetJointManager()) return nullptr;
+
+	return Context;
+}
+
+void UJointNodeBase::SetIsNodeBegunPlay(const bool bNewIsNodeBegunPlay)
+{
+	if (AJointActor* Context = GetSharedExecutionContext())
+	{
+		Context->FindOrAddSharedNodeRuntimeState(this).bIsNodeBegunPlay = bNewIsNodeBegunPlay;
+		
+		return;
+	}
+	
+	bIsNodeBegunPlay = bNewIsNodeBegunPlay;
+}
+
+void UJointNodeBase::SetIsNodeEndedPlay(const bool bNewIsNodeEndedPlay)
+{
+	if (AJointActor* Context = GetSharedExecutionContext())
+	{
+		Context->FindOrAddSharedNodeRuntimeState(this).bIsNodeEndedPlay = bNewIsNodeEndedPlay;
+		
+		return;
+	}
+	
+	bIsNodeEndedPlay = bNewIsNodeEndedPlay;
+}
+
+void UJointNodeBase::SetIsNodePending(const bool bNewIsNodePending)
+{
+	if (AJointActor* Context = GetSharedExecutionContext())
+	{
+		Context->FindOrAddSharedNodeRuntimeState(this).bIsNodePending = bNewIsNodePending;
+		
+		return;
+	}
+	
+	bIsNodePending = bNewIsNodePending;
+}
+
 bool UJointNodeBase::IsNodeActive() const
 {
-	return IsNodeBegunPlay() && !IsNodeEndedPlay();
+	if (const FJointNodeRuntimeState* State = nullptr; FindSharedRuntimeStateForRead(State))
+	{
+		return State && State->bIsNodeBegunPlay && !State->bIsNodeEndedPlay;
+	}
+
+	return bIsNodeBegunPlay && !bIsNodeEndedPlay;
 }
 
 void UJointNodeBase::PostNodeMarkedAsPending_Implementation()
@@ -917,6 +1274,12 @@ AJointActor* UJointNodeBase::GetHostingJointInstance() const
 {
 	if (HostingJointInstance.IsValid()) return HostingJointInstance.Get();
 	
+	// Shared nodes never cache the hosting instance - the Joint actor that is executing them provides itself instead.
+	if (AJointActor* Context = GetSharedExecutionContext()) return Context;
+
+	// Outside of the execution, a shared node can still be handled by the only Joint actor that plays it. (ex, timers, delegates)
+	if (AJointActor* Player = nullptr; FindSoleSharedPlayer(Player)) return Player;
+	
 	UJointManager* Manager = GetJointManager();
 	
 	if (!Manager) return nullptr;
@@ -938,9 +1301,9 @@ void UJointNodeBase::ReloadNode()
 		return;
 	}
 	
-	bIsNodeBegunPlay = false;
-	bIsNodeEndedPlay = false;
-	bIsNodePending = false;
+	SetIsNodeBegunPlay(false);
+	SetIsNodeEndedPlay(false);
+	SetIsNodePending(false);
 }
 
 
@@ -1019,7 +1382,7 @@ void UJointNodeBase::ProcessPreNodeBeginPlay()
 	
 	if (!Actor) return;
 	
-	bIsNodeBegunPlay = true;
+	SetIsNodeBegunPlay(true);
 
 	PreNodeBeginPlay();
 	
@@ -1048,7 +1411,7 @@ void UJointNodeBase::ProcessPreNodeEndPlay()
 	
 	if (!Actor) return;
 	
-	bIsNodeEndedPlay = true;
+	SetIsNodeEndedPlay(true);
 
 	MarkNodePendingByForce();
 	
@@ -1079,7 +1442,7 @@ void UJointNodeBase::ProcessPreMarkNodePending()
 	
 	if (!Actor) return;
 
-	bIsNodePending = true;
+	SetIsNodePending(true);
 
 	PreNodeMarkedAsPending();
 
@@ -1244,6 +1607,16 @@ void UJointNodeBase::NotifyParentGraph()
 void UJointNodeBase::PostEditImport()
 {
 	UObject::PostEditImport();
+
+	MarkFragmentIndexDirty();
+}
+
+void UJointNodeBase::PostEditUndo()
+{
+	UObject::PostEditUndo();
+
+	//Undo can revert the sub nodes or the tags without going through PostEditChangeProperty().
+	MarkFragmentIndexDirty();
 }
 
 
@@ -1268,6 +1641,8 @@ void UJointNodeBase::PostEditChangeProperty(struct FPropertyChangedEvent& Proper
 
 	SubNodes.Remove(nullptr);
 
+	MarkFragmentIndexDirty();
+
 	this->MarkPackageDirty();
 
 	this->GetOuter()->MarkPackageDirty();
@@ -22,6 +22,75 @@ FJointActorExecutionElement::FJointActorExecutionElement(const EJointActorExecut
 {
 }
 
+void FJointActorExecutionQueue::Enqueue(const FJointActorExecutionElement& NewElement)
+{
+	if (Count == Elements.Num()) Grow();
+
+	Elements[(Head + Count) & (Elements.Num() - 1)] = NewElement;
+
+	++Count;
+
+	PeakCount = FMath::Max(PeakCount, Count);
+}
+
+const FJointActorExecutionElement& FJointActorExecutionQueue::Peek() const
+{
+	check(Count > 0);
+
+	return Elements[Head];
+}
+
+void FJointActorExecutionQueue::Pop()
+{
+	check(Count > 0);
+
+	Head = (Head + 1) & (Elements.Num() - 1);
+
+	--Count;
+}
+
+void FJointActorExecutionQueue::Empty()
+{
+	Head = 0;
+	Count = 0;
+}
+
+const FJointActorExecutionElement& FJointActorExecutionQueue::operator[](const int32 Index) const
+{
+	check(Index >= 0 && Index < Count);
+
+	return Elements[(Head + Index) & (Elements.Num() - 1)];
+}
+
+TArray<FJointActorExecutionElement> FJointActorExecutionQueue::ToArray() const
+{
+	TArray<FJointActorExecutionElement> OutArray;
+
+	OutArray.Reserve(Count);
+
+	for (int32 i = 0; i < Count; ++i) OutArray.Add((*this)[i]);
+
+	return OutArray;
+}
+
+void FJointActorExecutionQueue::Grow()
+{
+	const int32 NewCapacity = FMath::Max(InitialCapacity, Elements.Num() * 2);
+
+	// Unroll the elements to the front of the new storage so the ring starts from 0 again.
+	TArray<FJointActorExecutionElement> NewElements;
+
+	NewElements.Reserve(NewCapacity);
+
+	for (int32 i = 0; i < Count; ++i) NewElements.Add(MoveTemp(Elements[(Head + i) & (Elements.Num() - 1)]));
+
+	NewElements.SetNum(NewCapacity);
+
+	Elements = MoveTemp(NewElements);
+
+	Head = 0;
+}
+
 FJointGraphNodePropertyData::FJointGraphNodePropertyData() : PropertyName(NAME_None)
 {
 }
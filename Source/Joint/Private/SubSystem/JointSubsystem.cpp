@@ -5,6 +5,7 @@
 
 #include "JointActor.h"
 #include "JointManager.h"
+#include "JointStats.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Blueprint.h"
 #include "UObject/UObjectIterator.h"
@@ -12,6 +13,20 @@
 
 #include "EngineUtils.h"
 #include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pooled Joint Hits"), STAT_JointPoolHits, STATGROUP_Joint);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pooled Joint Misses"), STAT_JointPoolMisses, STATGROUP_Joint);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Joint Actors"), STAT_JointPooledActors, STATGROUP_Joint);
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+static TAutoConsoleVariable<bool> CVarJointVerifyRegistry(
+	TEXT("Joint.VerifyRegistry"),
+	false,
+	TEXT("Cross-check every UJointSubsystem::FindJoint() lookup against a full scan of the Joint actors in the world."));
+
+#endif
 
 AJointActor* UJointSubsystem::CreateJoint(
 	UObject* WorldContextObject,
@@ -33,35 +48,386 @@ AJointActor* UJointSubsystem::CreateJoint(
 
 AJointActor* UJointSubsystem::FindJoint(UObject* WorldContextObject, FGuid JointGuid)
 {
-	if (WorldContextObject != nullptr && WorldContextObject->GetWorld())
+	if (WorldContextObject == nullptr || !WorldContextObject->GetWorld()) return nullptr;
+
+	UWorld* World = WorldContextObject->GetWorld();
+
+	UJointSubsystem* Subsystem = Get(WorldContextObject);
+
+	//No game instance to hold the registry (ex, editor worlds) - scan the world instead.
+	if (Subsystem == nullptr) return FindJointWithActorIterator(World, JointGuid);
+
+	AJointActor* FoundJoint = Subsystem->FindRegisteredJoint(World, JointGuid);
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+	if (CVarJointVerifyRegistry.GetValueOnGameThread())
+	{
+		AJointActor* IteratedJoint = FindJointWithActorIterator(World, JointGuid);
+
+		ensureMsgf(IteratedJoint == FoundJoint,
+			TEXT("Joint registry is out of sync for the Joint %s: registry returned %s, but the world has %s."),
+			*JointGuid.ToString(),
+			FoundJoint ? *FoundJoint->GetName() : TEXT("None"),
+			IteratedJoint ? *IteratedJoint->GetName() : TEXT("None"));
+	}
+
+#endif
+
+	return FoundJoint;
+}
+
+TArray<class AJointActor*> UJointSubsystem::GetAllJoints(UObject* WorldContextObject)
+{
+	TArray<AJointActor*> Array;
+
+	if (WorldContextObject == nullptr || !WorldContextObject->GetWorld()) return Array;
+
+	UWorld* World = WorldContextObject->GetWorld();
+
+	if (UJointSubsystem* Subsystem = Get(WorldContextObject))
 	{
-		for (TActorIterator<AJointActor> ActorItr(WorldContextObject->GetWorld()); ActorItr; ++ActorItr)
+		Array.Reserve(Subsystem->JointRegistry.Num());
+
+		for (const TPair<TWeakObjectPtr<AJointActor>, FJointRegistryEntry>& Pair : Subsystem->JointRegistry)
 		{
-			if (!(*ActorItr)->IsValidLowLevel()) { continue; }
+			AJointActor* Actor = Pair.Key.Get();
 
-			if ((*ActorItr)->JointGuid == JointGuid) return *ActorItr;
+			if (Actor != nullptr && Actor->GetWorld() == World) Array.Add(Actor);
 		}
+
+		return Array;
 	}
 
-	return nullptr;
+	for (TActorIterator<AJointActor> ActorItr(World); ActorItr; ++ActorItr)
+	{
+		if (!(*ActorItr)->IsValidLowLevel()) { continue; }
+
+		Array.Add(*ActorItr);
+	}
+
+	return Array;
 }
 
-TArray<class AJointActor*> UJointSubsystem::GetAllJoints(UObject* WorldContextObject)
+TArray<class AJointActor*> UJointSubsystem::GetJointsForJointManager(UObject* WorldContextObject, UJointManager* JointAsset)
 {
 	TArray<AJointActor*> Array;
 
-	if (WorldContextObject != nullptr && WorldContextObject->GetWorld())
+	if (WorldContextObject == nullptr || JointAsset == nullptr) return Array;
+
+	if (UJointSubsystem* Subsystem = Get(WorldContextObject))
 	{
-		for (TActorIterator<AJointActor> ActorItr(WorldContextObject->GetWorld()); ActorItr; ++ActorItr)
+		if (const TSet<TWeakObjectPtr<AJointActor>>* Joints = Subsystem->JointsByAsset.Find(JointAsset))
 		{
-			if (!(*ActorItr)->IsValidLowLevel()) { continue; }
+			CollectRegisteredJoints(WorldContextObject->GetWorld(), *Joints, Array);
+		}
+	}
+
+	return Array;
+}
 
-			Array.Add(*ActorItr);
+TArray<class AJointActor*> UJointSubsystem::GetJointsWithPlaybackState(UObject* WorldContextObject, EJointActorPlaybackState PlaybackState)
+{
+	TArray<AJointActor*> Array;
+
+	if (WorldContextObject == nullptr) return Array;
+
+	if (UJointSubsystem* Subsystem = Get(WorldContextObject))
+	{
+		if (const TSet<TWeakObjectPtr<AJointActor>>* Joints = Subsystem->JointsByPlaybackState.Find(PlaybackState))
+		{
+			CollectRegisteredJoints(WorldContextObject->GetWorld(), *Joints, Array);
 		}
 	}
+
 	return Array;
 }
 
+void UJointSubsystem::UpdateJointRegistration(AJointActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	const TWeakObjectPtr<AJointActor> ActorKey(Actor);
+
+	const FGuid NewJointGuid = Actor->JointGuid;
+	const TObjectKey<UJointManager> NewJointAsset(Actor->GetSourceJointManager());
+	const EJointActorPlaybackState NewPlaybackState = Actor->GetPlaybackState();
+
+	FJointRegistryEntry* Entry = JointRegistry.Find(ActorKey);
+
+	if (Entry == nullptr)
+	{
+		Entry = &JointRegistry.Add(ActorKey);
+
+		Entry->JointGuid = NewJointGuid;
+		Entry->JointAsset = NewJointAsset;
+		Entry->PlaybackState = NewPlaybackState;
+
+		JointsByGuid.Add(NewJointGuid, ActorKey);
+		JointsByAsset.FindOrAdd(NewJointAsset).Add(ActorKey);
+		JointsByPlaybackState.FindOrAdd(NewPlaybackState).Add(ActorKey);
+
+		return;
+	}
+
+	if (Entry->JointGuid != NewJointGuid)
+	{
+		if (const TWeakObjectPtr<AJointActor>* Registered = JointsByGuid.Find(Entry->JointGuid); Registered && *Registered == ActorKey)
+		{
+			JointsByGuid.Remove(Entry->JointGuid);
+		}
+
+		Entry->JointGuid = NewJointGuid;
+	}
+
+	//Always take the guid over - another actor might have been registered with the same guid.
+	JointsByGuid.Add(NewJointGuid, ActorKey);
+
+	if (Entry->JointAsset != NewJointAsset)
+	{
+		if (TSet<TWeakObjectPtr<AJointActor>>* Joints = JointsByAsset.Find(Entry->JointAsset)) Joints->Remove(ActorKey);
+
+		JointsByAsset.FindOrAdd(NewJointAsset).Add(ActorKey);
+
+		Entry->JointAsset = NewJointAsset;
+	}
+
+	if (Entry->PlaybackState != NewPlaybackState)
+	{
+		if (TSet<TWeakObjectPtr<AJointActor>>* Joints = JointsByPlaybackState.Find(Entry->PlaybackState)) Joints->Remove(ActorKey);
+
+		JointsByPlaybackState.FindOrAdd(NewPlaybackState).Add(ActorKey);
+
+		Entry->PlaybackState = NewPlaybackState;
+	}
+}
+
+void UJointSubsystem::UnregisterJoint(AJointActor* Actor)
+{
+	const TWeakObjectPtr<AJointActor> ActorKey(Actor);
+
+	FJointRegistryEntry Entry;
+
+	if (!JointRegistry.RemoveAndCopyValue(ActorKey, Entry)) return;
+
+	if (const TWeakObjectPtr<AJointActor>* Registered = JointsByGuid.Find(Entry.JointGuid); Registered && *Registered == ActorKey)
+	{
+		JointsByGuid.Remove(Entry.JointGuid);
+	}
+
+	if (TSet<TWeakObjectPtr<AJointActor>>* Joints = JointsByAsset.Find(Entry.JointAsset))
+	{
+		Joints->Remove(ActorKey);
+
+		if (Joints->IsEmpty()) JointsByAsset.Remove(Entry.JointAsset);
+	}
+
+	if (TSet<TWeakObjectPtr<AJointActor>>* Joints = JointsByPlaybackState.Find(Entry.PlaybackState)) Joints->Remove(ActorKey);
+}
+
+AJointActor* UJointSubsystem::FindRegisteredJoint(const UWorld* World, const FGuid& JointGuid) const
+{
+	const TWeakObjectPtr<AJointActor>* Registered = JointsByGuid.Find(JointGuid);
+
+	if (Registered == nullptr) return nullptr;
+
+	AJointActor* Actor = Registered->Get();
+
+	return Actor != nullptr && Actor->GetWorld() == World && Actor->JointGuid == JointGuid ? Actor : nullptr;
+}
+
+void UJointSubsystem::CollectRegisteredJoints(const UWorld* World, const TSet<TWeakObjectPtr<AJointActor>>& Source, TArray<AJointActor*>& OutJoints)
+{
+	OutJoints.Reserve(OutJoints.Num() + Source.Num());
+
+	for (const TWeakObjectPtr<AJointActor>& Joint : Source)
+	{
+		AJointActor* Actor = Joint.Get();
+
+		if (Actor != nullptr && Actor->GetWorld() == World) OutJoints.Add(Actor);
+	}
+}
+
+AJointActor* UJointSubsystem::FindJointWithActorIterator(UWorld* World, const FGuid& JointGuid)
+{
+	if (World == nullptr) return nullptr;
+
+	for (TActorIterator<AJointActor> ActorItr(World); ActorItr; ++ActorItr)
+	{
+		if (!(*ActorItr)->IsValidLowLevel()) { continue; }
+
+		if ((*ActorItr)->JointGuid == JointGuid) return *ActorItr;
+	}
+
+	return nullptr;
+}
+
+AJointActor* UJointSubsystem::AcquirePooledJoint(
+	UObject* WorldContextObject,
+	UJointManager* JointAssetToPlay,
+	TSubclassOf<AJointActor> OptionalJointInstanceSubclass)
+{
+	if (!WorldContextObject || !WorldContextObject->GetWorld() || JointAssetToPlay == nullptr || !JointAssetToPlay->IsValidLowLevel())
+		return nullptr;
+
+	UWorld* World = WorldContextObject->GetWorld();
+
+	UClass* ActorClass = OptionalJointInstanceSubclass.Get() ? OptionalJointInstanceSubclass.Get() : AJointActor::StaticClass();
+
+	UJointSubsystem* Subsystem = Get(WorldContextObject);
+
+	//No game instance to hold the pool (ex, editor worlds) - just create a new one.
+	if (Subsystem == nullptr) return CreateJoint(WorldContextObject, JointAssetToPlay, OptionalJointInstanceSubclass);
+
+	if (AJointActor* JointActor = Subsystem->PopPooledJoint(World, ActorClass, JointAssetToPlay))
+	{
+		++Subsystem->JointActorPoolStats.Hits;
+		INC_DWORD_STAT(STAT_JointPoolHits);
+
+		JointActor->ResetJointForReuse();
+
+		return JointActor;
+	}
+
+	++Subsystem->JointActorPoolStats.Misses;
+	INC_DWORD_STAT(STAT_JointPoolMisses);
+
+	return SpawnPooledJoint(World, ActorClass, JointAssetToPlay);
+}
+
+void UJointSubsystem::WarmUpJointPool(
+	UObject* WorldContextObject,
+	UJointManager* JointAsset,
+	TSubclassOf<AJointActor> OptionalJointInstanceSubclass,
+	int32 Count)
+{
+	if (!WorldContextObject || !WorldContextObject->GetWorld() || JointAsset == nullptr || !JointAsset->IsValidLowLevel())
+		return;
+
+	UJointSubsystem* Subsystem = Get(WorldContextObject);
+
+	if (Subsystem == nullptr) return;
+
+	UWorld* World = WorldContextObject->GetWorld();
+
+	UClass* ActorClass = OptionalJointInstanceSubclass.Get() ? OptionalJointInstanceSubclass.Get() : AJointActor::StaticClass();
+
+	TArray<TWeakObjectPtr<AJointActor>>& Bucket = Subsystem->JointActorPool.FindOrAdd(FJointActorPoolKey(ActorClass, JointAsset));
+
+	const int32 TargetCount = FMath::Min(Count, Subsystem->MaxPooledJointsPerKey);
+
+	Bucket.Reserve(TargetCount);
+
+	while (Bucket.Num() < TargetCount)
+	{
+		AJointActor* JointActor = SpawnPooledJoint(World, ActorClass, JointAsset);
+
+		if (JointActor == nullptr) break;
+
+		Bucket.Add(JointActor);
+
+		JointActor->bIsParkedInPool = true;
+
+		++Subsystem->JointActorPoolStats.NumPooled;
+		INC_DWORD_STAT(STAT_JointPooledActors);
+	}
+}
+
+void UJointSubsystem::FlushJointPool(UObject* WorldContextObject)
+{
+	UJointSubsystem* Subsystem = Get(WorldContextObject);
+
+	if (Subsystem == nullptr) return;
+
+	for (TPair<FJointActorPoolKey, TArray<TWeakObjectPtr<AJointActor>>>& Pair : Subsystem->JointActorPool)
+	{
+		for (const TWeakObjectPtr<AJointActor>& JointActor : Pair.Value)
+		{
+			if (JointActor.IsValid()) JointActor->Destroy();
+		}
+	}
+
+	Subsystem->JointActorPool.Empty();
+
+	DEC_DWORD_STAT_BY(STAT_JointPooledActors, Subsystem->JointActorPoolStats.NumPooled);
+
+	Subsystem->JointActorPoolStats.NumPooled = 0;
+}
+
+FJointActorPoolStats UJointSubsystem::GetJointPoolStats(UObject* WorldContextObject)
+{
+	if (UJointSubsystem* Subsystem = Get(WorldContextObject)) return Subsystem->JointActorPoolStats;
+
+	return FJointActorPoolStats();
+}
+
+bool UJointSubsystem::ReleaseJointToPool(AJointActor* Actor)
+{
+	if (Actor == nullptr || !Actor->IsPooledInstance() || Actor->IsActorBeingDestroyed()) return false;
+
+	//Already on the pool - adding it again would hand the same actor to two users.
+	if (Actor->bIsParkedInPool) return true;
+
+	TArray<TWeakObjectPtr<AJointActor>>& Bucket = JointActorPool.FindOrAdd(FJointActorPoolKey(Actor->GetClass(), Actor->GetSourceJointManager()));
+
+	if (Bucket.Num() >= MaxPooledJointsPerKey)
+	{
+		++JointActorPoolStats.Discarded;
+
+		return false;
+	}
+
+	Bucket.Add(Actor);
+
+	Actor->bIsParkedInPool = true;
+
+	++JointActorPoolStats.Released;
+	++JointActorPoolStats.NumPooled;
+	INC_DWORD_STAT(STAT_JointPooledActors);
+
+	return true;
+}
+
+AJointActor* UJointSubsystem::PopPooledJoint(UWorld* World, UClass* ActorClass, UJointManager* JointAsset)
+{
+	TArray<TWeakObjectPtr<AJointActor>>* Bucket = JointActorPool.Find(FJointActorPoolKey(ActorClass, JointAsset));
+
+	if (Bucket == nullptr) return nullptr;
+
+	while (!Bucket->IsEmpty())
+	{
+		AJointActor* JointActor = Bucket->Pop().Get();
+
+		--JointActorPoolStats.NumPooled;
+		DEC_DWORD_STAT(STAT_JointPooledActors);
+
+		if (JointActor == nullptr) continue;
+
+		JointActor->bIsParkedInPool = false;
+
+		//The actors from the other worlds (ex, after a level travel) or the ones that have been destroyed by someone else are dropped here.
+		if (!JointActor->IsActorBeingDestroyed() && JointActor->GetWorld() == World) return JointActor;
+	}
+
+	return nullptr;
+}
+
+AJointActor* UJointSubsystem::SpawnPooledJoint(UWorld* World, UClass* ActorClass, UJointManager* JointAsset)
+{
+	if (World == nullptr) return nullptr;
+
+	if (AJointActor* JointActor = World->SpawnActor<AJointActor>(ActorClass))
+	{
+		JointActor->bIsPooledInstance = true;
+
+		JointActor->RequestSetJointManager(JointAsset);
+
+		return JointActor;
+	}
+
+	return nullptr;
+}
+
 
 UJointSubsystem* UJointSubsystem::Get(UObject* WorldContextObject)
 {
@@ -98,6 +464,8 @@ TArray<FGuid> UJointSubsystem::GetJointsGuidEndedOnThisFrame(UObject* WorldConte
 void UJointSubsystem::OnJointStarted(AJointActor* Actor)
 {
 	if (Actor == nullptr && !Actor->IsValidLowLevel()) return;
+
+	UpdateJointRegistration(Actor);
 	
 	AddStartedJointToCaches(Actor);
 
@@ -111,6 +479,8 @@ void UJointSubsystem::OnJointStarted(AJointActor* Actor)
 void UJointSubsystem::OnJointEnded(AJointActor* Actor)
 {
 	if (Actor == nullptr && !Actor->IsValidLowLevel()) return;
+
+	UpdateJointRegistration(Actor);
 	
 	AddEndedJointToCaches(Actor);
 
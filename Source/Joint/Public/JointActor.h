@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
 #include "SharedType/JointSharedTypes.h"
 #include "JointActor.generated.h"
 
@@ -43,6 +44,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FJointNodePlaybackEvent, AJointActo
 
 class UJointSubsystem;
 class UJointNodeBase;
+class UAbilitySystemComponent;
 
 
 UCLASS()
@@ -52,26 +54,55 @@ class JOINT_API AJointActor : public AActor
 
 public:
 	// Sets default values for this actor's properties
-	AJointActor();
+	AJointActor(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 public:
+
+	/**
+	 * The name of the AbilitySystemComponent sub object.
+	 * Joint 2.14.0 : Subclasses can skip the creation of the default AbilitySystemComponent with ObjectInitializer.DoNotCreateDefaultSubobject(AJointActor::AbilitySystemComponentName).
+	 * In that case the component will be created on demand. (See EnsureAbilitySystemComponent())
+	 */
+	static FName AbilitySystemComponentName;
+	
 	/**
 	 * A component for the GAS implementation.
 	 * A Joint instance actor can have gameplay ability by itself, and it can be used in multiple situations.
+	 * It can be nullptr on the Joint actors that create the component on demand, until something requests it with EnsureAbilitySystemComponent().
 	 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="GAS")
 	TObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
 
 public:
+
+	/**
+	 * Get the AbilitySystemComponent of this Joint actor.
+	 * It has no side effect - on the Joint actors that create the component on demand, it returns nullptr until the component has been created. (See EnsureAbilitySystemComponent())
+	 */
 	UFUNCTION(BlueprintPure, Category="GAS")
 	UAbilitySystemComponent* GetAbilitySystemComponent() const;
 
+	/**
+	 * Get the AbilitySystemComponent of this Joint actor, and create it first on the authority if this actor doesn't have one yet.
+	 * On the clients, it returns the replicated component if it has been received.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintCallable, Category="GAS")
+	UAbilitySystemComponent* EnsureAbilitySystemComponent();
+
 	/**
 	 * Actual code where the node instance use to implement a default AbilitySystemComponent sub object.
 	 * Override this function to implement the AbilitySystemComponent with the subclass you desire.
 	 */
 	virtual void ImplementAbilitySystemComponent();
 
+	/**
+	 * Create the AbilitySystemComponent at runtime if this actor doesn't have one.
+	 * Only the authority creates the component, and the clients receive the replicated one.
+	 * @return Whether this actor has the AbilitySystemComponent after the call.
+	 */
+	virtual bool CreateAbilitySystemComponentOnDemand();
+
 public:
 	/**
 	 * The Guid of the Joint instance. Used to identify the instance on the world.
@@ -83,6 +114,7 @@ public:
 	 * The Joint manager this Joint actor plays.
 	 * It holds the copy of the original Joint manager.
 	 * This actor has the Joint manager's ownership on runtime.
+	 * When IsUsingSharedJointManager() is true, it holds the original asset itself instead. (See InstancingPolicy)
 	 */
 	//UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Joint", ReplicatedUsing = OnRep_JointManager)
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Joint")
@@ -91,7 +123,104 @@ public:
 	UFUNCTION()
 	void OnRep_JointManager(const UJointManager* PreviousJointManager);
 
-	
+public:
+
+	/**
+	 * How this Joint actor instances the Joint manager on RequestSetJointManager().
+	 * Duplicate : (default) the whole Joint manager will be duplicated for this actor.
+	 * Shared : the asset's node objects will be used as they are, and only the runtime state of the nodes will be stored on this actor.
+	 * Shared mode will fall back to Duplicate when any of the nodes on the Joint manager is not marked with bCanBeSharedAcrossInstances or replicates.
+	 * Joint 2.14.0 : introduced to reduce the spawn cost and memory of the Joint actors that play the same asset concurrently.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Joint|Instancing")
+	EJointManagerInstancingPolicy InstancingPolicy = EJointManagerInstancingPolicy::Duplicate;
+
+	/**
+	 * Which nodes this Joint actor registers as its replicated sub objects.
+	 * AllNodes : (default) every node that replicates is registered while the Joint manager is set.
+	 * ActiveNodes : only the manager fragments and the active nodes are registered. The nodes will be registered on their begin play and unregistered on their end play.
+	 * Joint 2.14.0 : introduced to reduce the replication cost of the Joints that have large graphs.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Joint|Replication")
+	EJointNodeReplicationPolicy NodeReplicationPolicy = EJointNodeReplicationPolicy::AllNodes;
+
+	/**
+	 * How many steps of the upcoming base nodes will be registered ahead of their begin play with the ActiveNodes policy.
+	 * The upcoming nodes are predicted from the static edges of the graph - the base nodes the playing node and its sub nodes refer to (See UJointManager::GetStaticNextBaseNodeTableIndices()) - so the clients can receive the next nodes before the Joint moves on to them.
+	 * The prediction never calls SelectNextNodes(), so the node logic runs only when the Joint actually moves on.
+	 * 0 disables the look-ahead - the nodes will be registered on their begin play only.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Joint|Replication", meta=(ClampMin = 0, EditCondition="NodeReplicationPolicy == EJointNodeReplicationPolicy::ActiveNodes"))
+	int32 NodeReplicationLookAhead = 1;
+
+	/**
+	 * Whether this Joint actor is playing the Joint manager asset directly with the shared node objects.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Joint|Instancing")
+	bool IsUsingSharedJointManager() const;
+
+	/**
+	 * Check whether the provided Joint manager can be played with the shared node objects.
+	 * It requires every node on the Joint manager to be marked with bCanBeSharedAcrossInstances, and none of them to replicate.
+	 */
+	static bool CanShareJointManager(UJointManager* InJointManager);
+
+private:
+
+	/**
+	 * Whether this Joint actor is playing the Joint manager asset directly with the shared node objects.
+	 */
+	UPROPERTY(Transient)
+	bool bIsUsingSharedJointManager = false;
+
+	/**
+	 * Runtime state of the nodes that are shared with the other Joint actors.
+	 * Only used when bIsUsingSharedJointManager is true.
+	 */
+	TMap<TObjectKey<UJointNodeBase>, FJointNodeRuntimeState> SharedNodeRuntimeStates;
+
+public:
+
+	/**
+	 * Find the runtime state of the provided node that is stored on this Joint actor.
+	 * Return nullptr if this actor doesn't store any state for the node yet.
+	 */
+	const FJointNodeRuntimeState* FindSharedNodeRuntimeState(const UJointNodeBase* InNode) const;
+
+	/**
+	 * Find or add the runtime state of the provided node on this Joint actor.
+	 */
+	FJointNodeRuntimeState& FindOrAddSharedNodeRuntimeState(const UJointNodeBase* InNode);
+
+public:
+
+	/**
+	 * Get the Joint actor that is currently executing the shared node objects.
+	 * Shared node objects can not hold a reference to their hosting Joint actor, so the Joint actor provides itself as the context while it is executing the nodes.
+	 * Return nullptr when no Joint actor is executing the shared nodes at the moment.
+	 */
+	static AJointActor* GetSharedExecutionContext();
+
+	/**
+	 * Find the Joint actors that are playing the provided Joint manager asset with the shared node objects and have any node runtime state at the moment.
+	 * Used to resolve the runtime state of the shared nodes when they are accessed outside of the shared execution context. (ex, UI, timers, delegates)
+	 * It stops counting at the second one, since the shared nodes only need to know whether there is exactly one.
+	 * @return The number of the players found, up to 2. OutFirstPlayer is the first one found.
+	 */
+	static int32 FindSharedJointManagerPlayers(const UJointManager* InJointManager, AJointActor*& OutFirstPlayer);
+
+private:
+
+	void RegisterAsSharedJointManagerPlayer();
+
+	void UnregisterAsSharedJointManagerPlayer();
+
+private:
+
+	friend struct FJointScopedSharedExecutionContext;
+
+
 private:
 #if WITH_EDITORONLY_DATA
 
@@ -120,9 +249,25 @@ public:
 	/**
 	 * The execution queue for the Joint playback. It holds the list of nodes with corresponding execution data (begin play, end play, pending, etc).
 	 * Joint 2.12.0 : now it uses queues for the playback. 
+	 * Joint 2.14.0 : BREAKING CHANGE - now it is a ring buffer and is no longer exposed to Blueprint.
+	 * The Blueprints that read this property must be changed to use GetQueuedExecutionElements(), which returns the same elements in the same order as the old array.
+	 * C++ code can keep using Num(), IsEmpty() and operator[] on it, but must use Enqueue() / Pop() instead of the TArray functions to modify it.
 	 */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Joint", Transient)
-	TArray<FJointActorExecutionElement> ExecutionQueue;
+	UPROPERTY(Transient)
+	FJointActorExecutionQueue ExecutionQueue;
+
+	/**
+	 * Get a copy of the queued execution elements in order.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Joint")
+	TArray<FJointActorExecutionElement> GetQueuedExecutionElements() const;
+
+	/**
+	 * Get the maximum number of the execution elements that were queued at once on this Joint actor.
+	 * Useful for profiling long chains of the node events. The deepest queue among all the Joint actors is also available on "stat Joint".
+	 */
+	UFUNCTION(BlueprintPure, Category = "Joint|Stats")
+	int32 GetExecutionQueuePeakDepth() const;
 	
 	
 private:
@@ -164,6 +309,8 @@ public:
 	TArray<TObjectPtr<UJointNodeBase>> KnownActiveNodes;
 
 public:
+
+	virtual void BeginPlay() override;
 	
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
@@ -204,6 +351,24 @@ private:
 	UFUNCTION()
 	void OnRep_CachedNodesForNetworking(const TArray<UJointNodeBase*>& PreviousCachedNodesForNetworking);
 
+	/**
+	 * The upcoming nodes that have been registered for the replication ahead of their begin play. (ActiveNodes policy only)
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UJointNodeBase>> LookAheadNodesForNetworking;
+
+	/**
+	 * The nodes that have ended play but must stay on the replicated node list until the changes they made on their end play have been sent. (ActiveNodes policy only)
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UJointNodeBase>> EndedNodesPendingNetworkingRemoval;
+
+	/**
+	 * The ended nodes that have gone through a net update since their end play. They are removed from the replicated node list on the next net update.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UJointNodeBase>> EndedNodesReadyForNetworkingRemoval;
+
 
 public:
 	/**
@@ -219,6 +384,20 @@ public:
 	UFUNCTION(BlueprintPure, BlueprintCallable, Category="Joint Playback")
 	virtual UJointManager* GetJointManager();
 
+	/**
+	 * Get the Joint manager that has been provided on RequestSetJointManager(). (Usually the asset that JointManager has been instanced from.)
+	 */
+	UFUNCTION(BlueprintPure, Category="Joint Playback")
+	UJointManager* GetSourceJointManager() const;
+
+private:
+
+	/**
+	 * The Joint manager that has been provided on RequestSetJointManager().
+	 */
+	UPROPERTY(Transient)
+	TObjectPtr<UJointManager> SourceJointManager;
+
 private:
 
 	/**
@@ -281,6 +460,12 @@ public:
 	UFUNCTION(BlueprintPure, Category="Joint Playback")
 	bool IsJointEnded();
 
+	/**
+	 * Get the playback state of this Joint actor. (Idle, Running, Ended)
+	 */
+	UFUNCTION(BlueprintPure, Category="Joint Playback")
+	EJointActorPlaybackState GetPlaybackState() const;
+
 public:
 	/**
 	 * Start the Joint.
@@ -323,6 +508,41 @@ public:
 	
 	void DestroyInstance();
 
+public:
+
+	/**
+	 * Whether this Joint actor has been created by the Joint actor pool of UJointSubsystem. (See UJointSubsystem::AcquirePooledJoint())
+	 * Pooled Joint actors return to the pool instead of being destroyed when DestroyJoint() is called.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Joint|Pool")
+	bool IsPooledInstance() const;
+
+	/**
+	 * Reset this Joint actor so it can play its Joint manager again from the start, with a new JointGuid.
+	 * The nodes will be reloaded with RequestReloadNode(). If any of the nodes can not be reloaded (bCanReloadNode), the Joint manager will be instanced again instead.
+	 * The bindings on the delegates of this actor will be cleared as well, since the actor is handed over to a new user.
+	 * Joint 2.14.0 : introduced for the Joint actor pool.
+	 */
+	void ResetJointForReuse();
+
+private:
+
+	/**
+	 * Whether this Joint actor has been created by the Joint actor pool of UJointSubsystem.
+	 */
+	UPROPERTY(Transient)
+	bool bIsPooledInstance = false;
+
+	/**
+	 * Whether this Joint actor is waiting on the pool at the moment. Set by the pool when it is released, and cleared when it is handed out again.
+	 */
+	bool bIsParkedInPool = false;
+
+	/**
+	 * The timer of the pending DestroyInstance() call, so DestroyJoint() schedules it only once.
+	 */
+	FTimerHandle DestroyInstanceTimerHandle;
+
 private:
 	/**
 	 * Multicasted implementation of StartJoint().
@@ -425,11 +645,52 @@ public:
 
 	virtual bool ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
 
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
 private:
 
-	//Don't call this in out of initialization.
+	/**
+	 * Rebuild the replicated node list if it has been marked as dirty. (on the Joint manager change)
+	 * Joint 2.14.0 : It applies only the difference with the current list now, instead of re-registering every node.
+	 */
 	void CacheNodesForNetworking();
 
+	/**
+	 * Collect the nodes that must be on the replicated node list with the current NodeReplicationPolicy.
+	 */
+	void CollectNodesForNetworking(TArray<UJointNodeBase*>& OutNodes) const;
+
+	/**
+	 * Replace the replicated node list with the provided nodes, registering and unregistering only the nodes that have been changed.
+	 */
+	void ApplyNodesForNetworking(const TArray<UJointNodeBase*>& NewNodes);
+
+	/**
+	 * Whether the replicated node list must be rebuilt on the next CacheNodesForNetworking() call.
+	 */
+	bool bIsNodesForNetworkingDirty = true;
+
+	/**
+	 * Predict the upcoming nodes from the static edges of the playing node and update LookAheadNodesForNetworking with them. (ActiveNodes policy only)
+	 */
+	void RefreshLookAheadNodesForNetworking();
+
+	/**
+	 * Collect the provided node and its sub nodes that must be replicated along with it.
+	 */
+	static void CollectReplicatedNodeHierarchy(UJointNodeBase* InNode, TArray<UJointNodeBase*>& OutNodes);
+
+	/**
+	 * Remove the ended nodes from the replicated node list once a net update has been sent after their end play.
+	 * Nodes that have begun play again or are still expected by the look-ahead are kept.
+	 */
+	void FlushEndedNodesForNetworking();
+
+	/**
+	 * Whether the provided node must stay on the replicated node list even though it is not playing. (ActiveNodes policy only)
+	 */
+	bool ShouldKeepInactiveNodeForNetworking(const UJointNodeBase* InNode) const;
+
 public:
 
 	void AddNodeForNetworking(class UJointNodeBase* InNode);
@@ -475,3 +736,23 @@ public:
 	FJointNodePlaybackEvent OnJointNodeMarkedAsPendingDelegate;
 	
 };
+
+
+/**
+ * A Joint actor that doesn't create the AbilitySystemComponent until something actually requests it.
+ * Use this class for the Joints that don't use GAS at all (ex, barks and ambient dialogues) to keep them lightweight -
+ * it saves the memory, the component registration cost and the replication of the component per actor.
+ *
+ * The component will be created on EnsureAbilitySystemComponent() or when the Joint manager is marked with bRequiresAbilitySystemComponent.
+ * Joint 2.14.0 : introduced.
+ */
+UCLASS()
+class JOINT_API AJointActor_Lightweight : public AJointActor
+{
+	GENERATED_BODY()
+
+public:
+
+	AJointActor_Lightweight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+	
+};
@@ -9,6 +9,7 @@
 #include "Templates/SubclassOf.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/Blueprint.h"
+#include "Misc/EngineVersionComparison.h"
 #include "JointManager.generated.h"
 
 //An asset class for storaging data and some functions.
@@ -18,10 +19,78 @@ class AJointActor;
 class UDataTable;
 class UJointNodeBase;
 class UJointFragment;
-
 class UActorChannel;
 class UEdGraph;
 
+/**
+ * A flat table of every node in a Joint manager, laid out in the hierarchy order.
+ * It lets the manager answer the guid lookups and walk the hierarchy without collecting the sub nodes recursively.
+ *
+ * The entries are stored in depth-first pre-order: the manager fragments and their lower hierarchy come first, then the base nodes and their lower hierarchy.
+ */
+struct JOINT_API FJointManagerNodeTable
+{
+public:
+
+	/**
+	 * Every node on the Joint manager, in the hierarchy order.
+	 */
+	TArray<UJointNodeBase*> Nodes;
+
+	/**
+	 * The index of the parent node's entry for each entry. INDEX_NONE for the manager fragments and the base nodes themselves.
+	 */
+	TArray<int32> ParentIndices;
+
+	/**
+	 * The entries in [0, NumManagerFragmentEntries) belong to the manager fragments' hierarchy.
+	 */
+	int32 NumManagerFragmentEntries = 0;
+
+	/**
+	 * Guid -> entry of the base node. Only the first node is recorded for the duplicated guids.
+	 */
+	TMap<FGuid, int32> BaseNodeGuidToIndex;
+
+	/**
+	 * Guid -> entry of the fragment. (manager fragments and the fragments under the base nodes) Only the first fragment is recorded for the duplicated guids.
+	 */
+	TMap<FGuid, int32> FragmentGuidToIndex;
+
+	/**
+	 * Hash of the class, the guid and the parent entry of every entry, in order.
+	 */
+	uint32 LayoutHash = 0;
+
+public:
+
+	void Build(const class UJointManager* InJointManager);
+
+	void Reset();
+
+	int32 Num() const { return Nodes.Num(); }
+
+	bool IsManagerFragmentEntry(const int32 Index) const { return Index < NumManagerFragmentEntries; }
+
+	/**
+	 * Whether the entry is the top of its hierarchy. (Directly attached manager fragment or a base node)
+	 */
+	bool IsRootEntry(const int32 Index) const { return ParentIndices[Index] == INDEX_NONE; }
+
+	/**
+	 * Whether the other table has the same entries in the same order, so the indices of one table can be used on the other.
+	 */
+	bool HasSameLayoutAs(const FJointManagerNodeTable& Other) const
+	{
+		return Num() == Other.Num() && NumManagerFragmentEntries == Other.NumManagerFragmentEntries && LayoutHash == Other.LayoutHash;
+	}
+
+private:
+
+	void AddEntry(UJointNodeBase* InNode, const int32 ParentIndex, const bool bIsBaseNode);
+	
+};
+
 UCLASS(Blueprintable)
 class JOINT_API UJointManager : public UObject
 {
@@ -51,6 +120,16 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Data")
 	TArray<TObjectPtr<UJointNodeBase>> ManagerFragments;
 
+public:
+
+	/**
+	 * Whether this Joint manager needs the AbilitySystemComponent on the Joint actor that plays it.
+	 * The Joint actors that create the component on demand (ex, AJointActor_Lightweight) will create it as soon as this Joint manager is set.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS")
+	bool bRequiresAbilitySystemComponent = false;
+
 public:
 	
 	/**
@@ -58,6 +137,61 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = "Joint")
 	AJointActor* GetHostingJointActor() const;
+
+public:
+
+	/**
+	 * Build the fragment indices of every node and fragment in this Joint manager that are marked as dirty.
+	 * Joint actor calls this function when it instances the Joint manager, so the fragment queries at runtime don't have to build them on the first call.
+	 */
+	void BuildFragmentIndices();
+
+
+	/**
+	 * Return the flat node table of this Joint manager. It will be rebuilt if it has been marked as dirty.
+	 * Building the table also assigns the node table index of every node on it. (See UJointNodeBase::GetNodeTableIndex())
+	 */
+	const FJointManagerNodeTable& GetNodeTable() const;
+
+	/**
+	 * Mark the node table as dirty, so it will be rebuilt on the next lookup.
+	 * The table is rebuilt automatically when the graph is edited, but if you change Nodes, ManagerFragments or the sub nodes at runtime, call this function.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint")
+	void MarkNodeTableDirty();
+
+	/**
+	 * Return the node table indices of the nodes that replicate by default on this Joint manager.
+	 * It is computed once per Joint manager and shared by every Joint actor that plays a duplicate of it, since the duplicates share the same node table layout.
+	 */
+	const TArray<int32>& GetReplicatedNodeTableIndices() const;
+
+	/**
+	 * Return the node table indices of the base nodes that the provided base node entry refers to on its properties or on its sub nodes' properties. (pin connections, node pointers and such)
+	 * These are the static edges of the graph - it never runs the node logic, so it can be used to predict the upcoming nodes without selecting them.
+	 * Like GetReplicatedNodeTableIndices(), it can be shared by the duplicates of this Joint manager.
+	 */
+	const TArray<int32>& GetStaticNextBaseNodeTableIndices(const int32 BaseNodeIndex) const;
+
+private:
+
+	/**
+	 * Cached node table. Not serialized - it is always rebuilt from the nodes. (on load, on duplication or lazily on the next lookup after being marked as dirty)
+	 */
+	mutable FJointManagerNodeTable NodeTable;
+
+	mutable bool bIsNodeTableDirty = true;
+
+	mutable TArray<int32> ReplicatedNodeTableIndices;
+
+	mutable bool bIsReplicatedNodeTableIndicesDirty = true;
+
+	mutable TMap<int32, TArray<int32>> StaticNextBaseNodeTableIndices;
+
+	mutable bool bIsStaticNextBaseNodeTableIndicesDirty = true;
+
+	void BuildStaticNextBaseNodeTableIndices() const;
 	
 public:
 	/**
@@ -278,6 +412,30 @@ public:
 
 	UPROPERTY()
 	TArray<FEditedDocumentInfo> LastEditedDocuments;
+
+	/**
+	 * Node classes the editor graph nodes of this asset refer to, including the missing ones. Written by the editor graph on save.
+	 * It is exposed as an asset registry tag, so the editor can search for class references without loading the asset.
+	 */
+	UPROPERTY()
+	TArray<FString> NodeClassReferences;
+
+	/**
+	 * Editor node classes of the editor graph nodes of this asset. Written by the editor graph on save.
+	 * It is exposed as an asset registry tag, so the editor can search for class references without loading the asset.
+	 */
+	UPROPERTY()
+	TArray<FString> EditorNodeClassReferences;
+
+	//Asset registry tag names of NodeClassReferences and EditorNodeClassReferences.
+	static const FName NodeClassReferencesTagName;
+	static const FName EditorNodeClassReferencesTagName;
+
+	//Asset registry tag that tells the asset has been saved with the class reference tags. (Empty tags are not stored in the asset registry.)
+	static const FName ClassReferencesVersionTagName;
+
+	//Separator of the entries in the class reference asset registry tags.
+	static const TCHAR* ClassReferencesTagSeparator;
 	
 #endif
 
@@ -341,5 +499,19 @@ public:
 public:
 
 	virtual void Serialize(FArchive& Ar) override;
+
+	virtual void PostLoad() override;
+
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+#if WITH_EDITORONLY_DATA
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#else
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#endif
+#endif
 	
 };
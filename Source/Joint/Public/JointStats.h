@@ -0,0 +1,10 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+/**
+ * Stat group for the Joint runtime. Use "stat Joint" to display it.
+ */
+DECLARE_STATS_GROUP(TEXT("Joint"), STATGROUP_Joint, STATCAT_Advanced);
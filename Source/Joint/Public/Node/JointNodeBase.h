@@ -43,6 +43,81 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJointNodeMarkedAsPending, UJointN
 
 DECLARE_DYNAMIC_DELEGATE_RetVal(TArray<FJointEdPinData>, FOnRequestJointPinData);
 
+/**
+ * Lookup tables for the fragments on the lower hierarchy of a node.
+ * It lets the FindFragment~OnLowerHierarchy() functions answer the queries without walking through the whole sub node tree every time.
+ *
+ * The index is owned by the node and is rebuilt lazily on the first query after it has been marked as dirty. (See UJointNodeBase::MarkFragmentIndexDirty())
+ * The tag queries also rebuild it when the tags of any indexed fragment have been changed since the last build, since NodeTags can be written directly.
+ */
+struct JOINT_API FJointFragmentIndex
+{
+public:
+
+	/**
+	 * Every fragment on the lower hierarchy, in the same (depth-first) order that UJointNodeBase::IterateAndCollectAllFragmentsUnderNode() collects them.
+	 * All the other tables store indices into this array, sorted in ascending order.
+	 */
+	TArray<UJointFragment*> Fragments;
+
+	/**
+	 * Guid -> fragment. Only the first fragment is recorded for the duplicated guids.
+	 */
+	TMap<FGuid, int32> GuidToIndex;
+
+	/**
+	 * Class -> fragments of the class and its subclasses. (up to UJointFragment)
+	 */
+	TMap<const UClass*, TArray<int32>> ClassToIndices;
+
+	/**
+	 * Tag -> fragments that have the tag explicitly. Used for the exact queries.
+	 */
+	TMap<FGameplayTag, TArray<int32>> ExactTagToIndices;
+
+	/**
+	 * Tag -> fragments that have the tag or any of its child tags. Used for the non-exact queries.
+	 */
+	TMap<FGameplayTag, TArray<int32>> TagToIndices;
+
+	/**
+	 * Hash of the tags of each fragment at the time of the build. Used to detect the tags that have been changed without marking the index as dirty.
+	 */
+	TArray<uint32> TagHashes;
+
+public:
+
+	void Build(UJointNodeBase* InNode);
+
+	/**
+	 * Whether the tags of any fragment have been changed since the index was built.
+	 */
+	bool HasStaleTags() const;
+
+	static uint32 HashTags(const FGameplayTagContainer& InTags);
+
+	void Reset();
+
+	const TArray<int32>* FindTagIndices(const FGameplayTag& InTag, const bool bExact) const;
+
+	const TArray<int32>* FindClassIndices(const UClass* InClass) const;
+
+	UJointFragment* FindFragmentWithGuid(const FGuid& InGuid) const;
+
+public:
+
+	/**
+	 * Collect the indices of the fragments that have any of the provided tags, in ascending order.
+	 */
+	void CollectIndicesWithAnyTags(const FGameplayTagContainer& InTagContainer, const bool bExact, TArray<int32>& OutIndices, const bool bFirstOnly) const;
+
+	/**
+	 * Collect the indices of the fragments that have all of the provided tags, in ascending order.
+	 */
+	void CollectIndicesWithAllTags(const FGameplayTagContainer& InTagContainer, const bool bExact, TArray<int32>& OutIndices, const bool bFirstOnly) const;
+	
+};
+
 UCLASS(Abstract, Blueprintable, BlueprintType, Category = "Joint")
 class JOINT_API UJointNodeBase : public UObject, public IGameplayTagAssetInterface
 {
@@ -62,6 +137,17 @@ private:
 	
 	friend class UJointEdGraphNode; // to allow the graph node to reset the guid when duplicating nodes.
 
+	/**
+	 * The index of this node on the Joint manager's node table. (See FJointManagerNodeTable)
+	 * It is assigned whenever the table is built (including the save and cook time) and is preserved by the duplication,
+	 * so the same node on the asset and its runtime duplicates always share the same index.
+	 * INDEX_NONE if the node has never been laid out on a table.
+	 */
+	UPROPERTY()
+	int32 NodeTableIndex = INDEX_NONE;
+
+	friend struct FJointManagerNodeTable; // to allow the node table to assign the index.
+
 public:
 	/**
 	 * The parent node of this node.
@@ -90,10 +176,19 @@ public:
 	 * The best expected use-case will be using it on the Joint manager fragments and marking them with their roles on the graph, And basically that is what we intended the manager fragment to be.
 	 * 
 	 * If you really need to find a specific node on the random location on the graph, then try to make a manager fragment that hold the Joint node pointer to that node and utilize that if possible.
+	 *
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node Tag")
 	FGameplayTagContainer NodeTags;
 
+	/**
+	 * Set the node tags of this node and mark the fragment index of this node and its parent nodes as dirty.
+	 * Writing NodeTags directly works as well, since the tag queries detect the changed tags, but this skips that check on the next query.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Node Tag")
+	void SetNodeTags(const FGameplayTagContainer& InNodeTags);
+
 public:
 	/**
 	 * A delegate that will be broadcast when this node has begun and before executing OnNodeBeginPlay()
@@ -152,6 +247,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Node")
 	const FGuid& GetNodeGuid() const;
 
+	/**
+	 * Return the index of the node on the Joint manager's node table. INDEX_NONE if the node has never been laid out on a table.
+	 */
+	int32 GetNodeTableIndex() const;
+
 public:
 	//Begin of IGameplayTagAssetInterface implementation
 	virtual void GetOwnedGameplayTags(FGameplayTagContainer& TagContainer) const override;
@@ -243,6 +343,32 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Fragment")
 	TArray<UJointFragment*> GetAllFragmentsOnLowerHierarchy();
 
+	/**
+	 * Mark the fragment index of this node and its parent nodes as dirty, so they will be rebuilt on the next query.
+	 * The index is rebuilt automatically when the node is edited on the editor, but if you change the sub nodes at runtime, call this function on the changed node. (The changed tags are detected by the tag queries.)
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Fragment")
+	void MarkFragmentIndexDirty();
+
+	/**
+	 * Build the fragment index of this node if it has been marked as dirty.
+	 * Joint actor calls this function for every node when it instances a Joint manager, so the first query does not have to pay for it.
+	 */
+	void BuildFragmentIndexIfDirty();
+
+	/**
+	 * Return the fragment index of this node. It will be rebuilt if it has been marked as dirty.
+	 */
+	const FJointFragmentIndex& GetFragmentIndex();
+
+private:
+
+	/**
+	 * Return the fragment index of this node for the tag queries. It will be rebuilt if the tags of any indexed fragment have been changed as well.
+	 */
+	const FJointFragmentIndex& GetFragmentIndexForTagQuery();
+
 public:
 	/**
 	 * Find a fragment by the provided tag.
@@ -425,6 +551,19 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Lifecycle")
 	bool bCanReloadNode = true;
 
+	/**
+	 * Whether this node can be shared across the Joint actors that play the same Joint manager asset with the Shared instancing policy.
+	 * Shared nodes are the asset's node objects themselves, and their runtime state (begin play, end play, pending) is stored on each Joint actor.
+	 * 
+	 * Only mark the nodes that do not modify their own properties on the playback, and do not run any latent action that calls the node functions later (timers, delays, async tasks).
+	 * Shared nodes can only find their hosting Joint actor while the Joint actor is executing them, or when only one Joint actor plays the asset at the moment.
+	 * Otherwise the requests made on the node itself (RequestNodeEndPlay(), MarkNodePendingByForce(), RequestReloadNode()) are ignored - call them on the Joint actor instead. (ex, AJointActor::RequestNodeEndPlay())
+	 * If any node on the Joint manager is not marked with this, the Joint actor will duplicate the Joint manager as before.
+	 * Joint 2.14.0 : introduced with EJointManagerInstancingPolicy::Shared.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Lifecycle|Instancing")
+	bool bCanBeSharedAcrossInstances = false;
+
 public:
 	/**
 	 * Play this node's sub nodes' playback.
@@ -447,6 +586,7 @@ public:
 	
 	/**
 	 * Request the hosting Joint instance to end this node's playback.
+	 * It does nothing if the hosting Joint instance can not be found. (See bCanBeSharedAcrossInstances for the shared nodes.)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Node")
 	void RequestNodeEndPlay();
@@ -549,6 +689,7 @@ protected:
 public:
 	/**
 	 * Mark this node pending.
+	 * It does nothing if the hosting Joint instance can not be found. (See bCanBeSharedAcrossInstances for the shared nodes.)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Node")
 	void MarkNodePendingByForce();
@@ -596,6 +737,38 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Node")
 	bool IsNodeActive() const;
 
+public:
+
+	/**
+	 * Check if the node is begun play on the provided Joint actor.
+	 * Use the "For" versions when the node can be shared across the Joint actors (See bCanBeSharedAcrossInstances) and you access it outside of its own execution (ex, UI, timers, delegates),
+	 * since a shared node has a different state for each Joint actor that plays it.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Node")
+	bool IsNodeBegunPlayFor(const AJointActor* JointActor) const;
+
+	/**
+	 * Check if the node is ended play on the provided Joint actor. See IsNodeBegunPlayFor().
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Node")
+	bool IsNodeEndedPlayFor(const AJointActor* JointActor) const;
+
+	/**
+	 * Check if the node is on pending on the provided Joint actor. See IsNodeBegunPlayFor().
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Node")
+	bool IsNodePendingFor(const AJointActor* JointActor) const;
+
+	/**
+	 * Check if the node is active on the provided Joint actor. See IsNodeBegunPlayFor().
+	 * Joint 2.14.0 : introduced.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Node")
+	bool IsNodeActiveFor(const AJointActor* JointActor) const;
+
 private:
 	/**
 	 * True if the node is begun played.
@@ -621,6 +794,45 @@ private:
 	UPROPERTY(BlueprintGetter=IsNodePending, Category = "Data", Transient)
 	bool bIsNodePending = false;
 
+private:
+
+	/**
+	 * Return the Joint actor that is executing this node as a shared node object.
+	 * Return nullptr if this node is not being executed as a shared node, which means the node holds its runtime state by itself.
+	 */
+	AJointActor* GetSharedExecutionContext() const;
+
+	/**
+	 * Find the runtime state of this node for reading.
+	 * Return false if this node holds its runtime state by itself. Otherwise OutState is the state stored on the Joint actor that plays this node, or nullptr if it has none.
+	 * Outside of the shared execution context, the state is resolved through the only Joint actor that plays the shared node. If several of them play it, the state is ambiguous and OutState will be nullptr.
+	 */
+	bool FindSharedRuntimeStateForRead(const FJointNodeRuntimeState*& OutState) const;
+
+	/**
+	 * Outside of the shared execution context, find the only Joint actor that plays this node as a shared node.
+	 * Return false if no Joint actor plays this node as a shared node. OutPlayer is nullptr if several of them play it - it will be logged once per node.
+	 */
+	bool FindSoleSharedPlayer(AJointActor*& OutPlayer) const;
+
+	//Whether the ambiguous access of this shared node has been logged already.
+	mutable bool bHasReportedAmbiguousSharedPlayers = false;
+
+	void SetIsNodeBegunPlay(const bool bNewIsNodeBegunPlay);
+
+	void SetIsNodeEndedPlay(const bool bNewIsNodeEndedPlay);
+
+	void SetIsNodePending(const bool bNewIsNodePending);
+
+private:
+
+	/**
+	 * Cached lookup tables for the fragments on the lower hierarchy. Not serialized - it is always rebuilt from the sub nodes.
+	 */
+	FJointFragmentIndex FragmentIndex;
+
+	bool bIsFragmentIndexDirty = true;
+
 
 	/**
 	 * Dev note for the basic concept for the life cycle and pending state.
@@ -745,6 +957,8 @@ public:
 
 	virtual void PostEditImport() override;
 
+	virtual void PostEditUndo() override;
+
 #endif
 
 public:
@@ -900,6 +1114,30 @@ public:
 
 	virtual void OnCompileNode_Implementation(TArray<FJointEdLogMessage>& LogMessages);
 
+#if WITH_EDITOR
+
+	/**
+	 * Return true if the result of OnCompileNode() can rely on any node in the graph, not only on this node, its parent, sub nodes and connected nodes.
+	 * Those nodes are compiled again on every incremental compilation of the graph.
+	 * By default, it returns true for the Blueprint classes that override OnCompileNode() unless bIsCompileResultLocalToNode is set. Override this if your native OnCompileNode() looks up other nodes.
+	 * Joint 2.14.0 : introduced.
+	 */
+	virtual bool IsCompileResultDependentOnGraph() const;
+
+#endif
+
+#if WITH_EDITORONLY_DATA
+
+	/**
+	 * Whether OnCompileNode() of this node only looks at this node, its parent, its sub nodes and the nodes it's connected to.
+	 * Enable it to let the Blueprint nodes that override OnCompileNode() skip the compilation when nothing related to them has been changed.
+	 * Joint 2.14.0 : introduced.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Editor|Compilation")
+	bool bIsCompileResultLocalToNode = false;
+
+#endif
+
 public:
 	static UJointFragment* IterateAndGetTheFirstFragmentForClassUnderNode(
 		UJointNodeBase* NodeToCollect, TSubclassOf<UJointFragment> SpecificClassToFind);
@@ -85,7 +85,156 @@ public:
 	{
 		return ExecutionElementGuid == Other.ExecutionElementGuid;
 	}
-	
+
+};
+
+
+/**
+ * A growable ring buffer of the execution elements for the Joint actor.
+ * Joint 2.14.0 : replaced the plain array queue, which shifted the whole array on every pop.
+ * Both enqueue and pop are O(1), and the storage is reused once it has grown to the peak depth of the playback.
+ */
+USTRUCT()
+struct JOINT_API FJointActorExecutionQueue
+{
+	GENERATED_BODY()
+
+public:
+
+	void Enqueue(const FJointActorExecutionElement& NewElement);
+
+	/**
+	 * Return the first element of the queue. The queue must not be empty.
+	 */
+	const FJointActorExecutionElement& Peek() const;
+
+	/**
+	 * Discard the first element of the queue. The queue must not be empty.
+	 */
+	void Pop();
+
+	/**
+	 * Remove all the elements from the queue while keeping the storage.
+	 */
+	void Empty();
+
+	int32 Num() const { return Count; }
+
+	bool IsEmpty() const { return Count == 0; }
+
+	/**
+	 * The maximum number of the elements that were in the queue at once.
+	 */
+	int32 GetPeakNum() const { return PeakCount; }
+
+	/**
+	 * Start tracking the peak depth again from the current number of the elements.
+	 */
+	void ResetPeakNum() { PeakCount = Count; }
+
+	/**
+	 * Return the element at the provided position from the front of the queue.
+	 */
+	const FJointActorExecutionElement& operator[](const int32 Index) const;
+
+	/**
+	 * Copy the queued elements in order.
+	 */
+	TArray<FJointActorExecutionElement> ToArray() const;
+
+private:
+
+	void Grow();
+
+private:
+
+	/**
+	 * Storage of the ring buffer. Its size is always zero or a power of two.
+	 */
+	UPROPERTY(Transient)
+	TArray<FJointActorExecutionElement> Elements;
+
+	int32 Head = 0;
+
+	int32 Count = 0;
+
+	int32 PeakCount = 0;
+
+	static constexpr int32 InitialCapacity = 16;
+
+};
+
+
+/**
+ * How the Joint actor instances the Joint manager it plays.
+ * Joint 2.14.0 : introduced to avoid deep-copying the whole asset for every Joint actor.
+ */
+UENUM(BlueprintType)
+enum class EJointManagerInstancingPolicy : uint8
+{
+	// Duplicate the whole Joint manager for each Joint actor. (Legacy behavior)
+	Duplicate UMETA(DisplayName="Duplicate"),
+	// Use the asset's node objects as they are, and keep only the runtime state of the nodes on the Joint actor.
+	// Falls back to Duplicate if any of the nodes on the Joint manager can not be shared. (See UJointNodeBase::bCanBeSharedAcrossInstances)
+	Shared UMETA(DisplayName="Shared"),
+};
+
+/**
+ * Which nodes a Joint actor registers as its replicated sub objects.
+ */
+UENUM(BlueprintType)
+enum class EJointNodeReplicationPolicy : uint8
+{
+	// Every node that replicates is registered for the whole lifetime of the Joint. (Legacy behavior)
+	AllNodes UMETA(DisplayName="All Nodes"),
+	// Only the manager fragments, the nodes that are active at the moment (begun play, not ended yet) and the upcoming nodes of the look-ahead are registered.
+	ActiveNodes UMETA(DisplayName="Active Nodes"),
+};
+
+/**
+ * Playback state of a Joint actor, used to index the Joint actors on UJointSubsystem.
+ */
+UENUM(BlueprintType)
+enum class EJointActorPlaybackState : uint8
+{
+	// The Joint actor has not started its Joint yet.
+	Idle UMETA(DisplayName="Idle"),
+	// The Joint actor is playing its Joint.
+	Running UMETA(DisplayName="Running"),
+	// The Joint actor has ended its Joint.
+	Ended UMETA(DisplayName="Ended"),
+};
+
+
+/**
+ * Mutable runtime state of a node that is being played by a Joint actor.
+ * When the Joint actor shares the node objects of the asset, this state is stored on the Joint actor per node instead of the node itself.
+ */
+USTRUCT()
+struct JOINT_API FJointNodeRuntimeState
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(Transient)
+	bool bIsNodeBegunPlay = false;
+
+	UPROPERTY(Transient)
+	bool bIsNodeEndedPlay = false;
+
+	UPROPERTY(Transient)
+	bool bIsNodePending = false;
+
+public:
+
+	void Reset()
+	{
+		bIsNodeBegunPlay = false;
+		bIsNodeEndedPlay = false;
+		bIsNodePending = false;
+	}
+
 };
 
 
@@ -6,6 +6,7 @@
 #include "JointActor.h"
 #include "GameplayTagContainer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "JointSubsystem.generated.h"
 
 class AJointActor;
@@ -19,6 +20,48 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnJointBegin, AJointActor*, JointI
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnJointEnd, AJointActor*, JointInstance, FGuid, JointGuid);
 
 
+/**
+ * Statistics of the Joint actor pool of UJointSubsystem.
+ */
+USTRUCT(BlueprintType)
+struct JOINT_API FJointActorPoolStats
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Number of the acquisitions that have been served with a pooled Joint actor.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pool")
+	int32 Hits = 0;
+
+	/**
+	 * Number of the acquisitions that had to spawn a new Joint actor.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pool")
+	int32 Misses = 0;
+
+	/**
+	 * Number of the Joint actors that have been returned to the pool.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pool")
+	int32 Released = 0;
+
+	/**
+	 * Number of the pooled Joint actors that have been destroyed because the pool was full.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pool")
+	int32 Discarded = 0;
+
+	/**
+	 * Number of the Joint actors that are waiting on the pool at the moment.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Pool")
+	int32 NumPooled = 0;
+};
+
+
 UCLASS()
 class JOINT_API UJointSubsystem : public UGameInstanceSubsystem
 {
@@ -75,6 +118,30 @@ public:
 		UObject* WorldContextObject
 	);
 
+	/**
+	 * Get all the Joints in the world that have been set with the provided Joint manager. (See AJointActor::GetSourceJointManager())
+	 * @param WorldContextObject An object that this function will grab the world from. You can provide the subsystem itself. (In Blueprint, it will be automatically filled out.)
+	 * @param JointAsset The Joint manager to search for.
+	 * @return An array of the Joints that play the provided Joint manager.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint", meta=(WorldContext="WorldContextObject"))
+	static TArray<class AJointActor*> GetJointsForJointManager(
+		UObject* WorldContextObject,
+		UJointManager* JointAsset
+	);
+
+	/**
+	 * Get all the Joints in the world that are on the provided playback state.
+	 * @param WorldContextObject An object that this function will grab the world from. You can provide the subsystem itself. (In Blueprint, it will be automatically filled out.)
+	 * @param PlaybackState The playback state to search for.
+	 * @return An array of the Joints on the provided playback state.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint", meta=(WorldContext="WorldContextObject"))
+	static TArray<class AJointActor*> GetJointsWithPlaybackState(
+		UObject* WorldContextObject,
+		EJointActorPlaybackState PlaybackState
+	);
+
 	
 	/**
 	 * Get singleton instance of the subsystem.
@@ -82,6 +149,89 @@ public:
 	 */
 	static UJointSubsystem* Get(UObject* WorldContextObject);
 
+public:
+
+	/**
+	 * Get a Joint actor from the pool for the provided Joint manager, or create a new one if there is nothing on the pool. (same as CreateJoint())
+	 * The actors created by this function return to the pool when they are destroyed with DestroyJoint() (which happens automatically when the Joint ends),
+	 * and they will be reset with AJointActor::ResetJointForReuse() when they are handed out again.
+	 * 
+	 * Use this function for the Joints that start and end frequently, such as barks and ambient dialogues.
+	 * Need to call StartJoint() manually to actually start off the Joint.
+	 * Joint 2.14.0 : introduced.
+	 * @param WorldContextObject An object that this function will grab the world from. You can provide the subsystem itself. (In Blueprint, it will be automatically filled out.)
+	 * @param JointAssetToPlay A Joint manager to use on the Joint actor.
+	 * @param OptionalJointInstanceSubclass A subclass of the Joint actor to use. If none specified, it will use AJointActor.
+	 * @return A Joint actor that is ready to start.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Pool", meta=(WorldContext="WorldContextObject"))
+	static AJointActor* AcquirePooledJoint(
+		UObject* WorldContextObject,
+		UJointManager* JointAssetToPlay,
+		TSubclassOf<AJointActor> OptionalJointInstanceSubclass
+	);
+
+	/**
+	 * Spawn Joint actors for the provided Joint manager and put them on the pool until the pool has the provided number of actors for it.
+	 * Call it on the loading screen or the level start to avoid the spawn cost while playing.
+	 * @param WorldContextObject An object that this function will grab the world from. You can provide the subsystem itself. (In Blueprint, it will be automatically filled out.)
+	 * @param JointAsset A Joint manager to warm up the pool for.
+	 * @param OptionalJointInstanceSubclass A subclass of the Joint actor to use. If none specified, it will use AJointActor.
+	 * @param Count Number of the actors to keep on the pool. It will be clamped by MaxPooledJointsPerKey.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Pool", meta=(WorldContext="WorldContextObject"))
+	static void WarmUpJointPool(
+		UObject* WorldContextObject,
+		UJointManager* JointAsset,
+		TSubclassOf<AJointActor> OptionalJointInstanceSubclass,
+		int32 Count
+	);
+
+	/**
+	 * Destroy all the Joint actors on the pool.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Pool", meta=(WorldContext="WorldContextObject"))
+	static void FlushJointPool(UObject* WorldContextObject);
+
+	/**
+	 * Get the statistics of the Joint actor pool.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Pool", meta=(WorldContext="WorldContextObject"))
+	static FJointActorPoolStats GetJointPoolStats(UObject* WorldContextObject);
+
+public:
+
+	/**
+	 * The maximum number of the Joint actors the pool keeps for each pair of the Joint actor class and Joint manager asset.
+	 * The Joint actors that are released when the pool is full will be destroyed.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Joint|Pool")
+	int32 MaxPooledJointsPerKey = 32;
+
+private:
+
+	/**
+	 * Return the provided pooled Joint actor to the pool.
+	 * @return false if the pool refused it. The caller must destroy the actor in that case.
+	 */
+	bool ReleaseJointToPool(AJointActor* Actor);
+
+	AJointActor* PopPooledJoint(UWorld* World, UClass* ActorClass, UJointManager* JointAsset);
+
+	static AJointActor* SpawnPooledJoint(UWorld* World, UClass* ActorClass, UJointManager* JointAsset);
+
+private:
+
+	using FJointActorPoolKey = TPair<TObjectKey<UClass>, TObjectKey<UJointManager>>;
+
+	/**
+	 * Joint actors that are waiting on the pool, per actor class and Joint manager asset.
+	 * The actors are owned by the world, so the pool only holds weak references to them.
+	 */
+	TMap<FJointActorPoolKey, TArray<TWeakObjectPtr<AJointActor>>> JointActorPool;
+
+	FJointActorPoolStats JointActorPoolStats;
+
 public:
 
 
@@ -119,6 +269,46 @@ private:
 
 	friend AJointActor;
 
+private:
+
+	/**
+	 * Register the provided Joint actor on the registry, or update its entry with its current guid, source Joint manager and playback state.
+	 */
+	void UpdateJointRegistration(AJointActor* Actor);
+
+	/**
+	 * Remove the provided Joint actor from the registry.
+	 */
+	void UnregisterJoint(AJointActor* Actor);
+
+	AJointActor* FindRegisteredJoint(const UWorld* World, const FGuid& JointGuid) const;
+
+	static void CollectRegisteredJoints(const UWorld* World, const TSet<TWeakObjectPtr<AJointActor>>& Source, TArray<AJointActor*>& OutJoints);
+
+	static AJointActor* FindJointWithActorIterator(UWorld* World, const FGuid& JointGuid);
+
+private:
+
+	/**
+	 * A registry entry of a Joint actor. It remembers the keys the actor has been indexed with, so the actor can be removed from the indices even after its data has been changed.
+	 */
+	struct FJointRegistryEntry
+	{
+		FGuid JointGuid;
+
+		TObjectKey<UJointManager> JointAsset;
+
+		EJointActorPlaybackState PlaybackState = EJointActorPlaybackState::Idle;
+	};
+
+	TMap<TWeakObjectPtr<AJointActor>, FJointRegistryEntry> JointRegistry;
+
+	TMap<FGuid, TWeakObjectPtr<AJointActor>> JointsByGuid;
+
+	TMap<TObjectKey<UJointManager>, TSet<TWeakObjectPtr<AJointActor>>> JointsByAsset;
+
+	TMap<EJointActorPlaybackState, TSet<TWeakObjectPtr<AJointActor>>> JointsByPlaybackState;
+
 public:
 
 	/**
@@ -22,7 +22,9 @@
 #include "Node/JointEdGraphNode.h"
 #include "Node/JointNodeBase.h"
 
+#include "Containers/Ticker.h"
 #include "Modules/ModuleManager.h"
+#include "UObject/ObjectSaveContext.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
 
@@ -67,13 +69,19 @@ void UJointEdGraph::PostEditChangeProperty(FPropertyChangedEvent& PropertyChange
 
 	RecacheNodes();
 
-	UpdateGraph();
+	RequestGraphUpdate(EJointGraphUpdatePhase::PropertyChangePhases, true);
 }
 
 void UJointEdGraph::NotifyGraphChanged()
 {
 	Super::NotifyGraphChanged();
 
+	if (IsLocked())
+	{
+		bHasPendingNodeRecache = true;
+		return;
+	}
+
 	RecacheNodes();
 
 	UpdateGraph();
@@ -84,6 +92,13 @@ void UJointEdGraph::NotifyGraphChanged(const FEdGraphEditAction& InAction)
 {
 	Super::NotifyGraphChanged(InAction);
 
+	//Bulk edits (ex, paste) lock the graph and add the nodes one by one - recache once on the next access instead of walking the whole graph for every node.
+	if (IsLocked())
+	{
+		bHasPendingNodeRecache = true;
+		return;
+	}
+
 	RecacheNodes();
 
 	UpdateGraph();
@@ -99,40 +114,167 @@ void UJointEdGraph::NotifyGraphRequestUpdate()
 
 void UJointEdGraph::UpdateGraph()
 {
-	if (!IsLocked())
+	RequestGraphUpdate(EJointGraphUpdatePhase::All);
+}
+
+void UJointEdGraph::RequestGraphUpdate(EJointGraphUpdatePhase Phases, const bool bDeferFlush)
+{
+	//Some instances might trigger graph updates during the process - ignore them like a locked graph does.
+	if (IsLocked() || bIsFlushingGraphUpdate) return;
+
+	if (EnumHasAnyFlags(Phases, EJointGraphUpdatePhase::DataPhases))
 	{
-		//Lock the graph to avoid multiple updates during the process (some instances might trigger graph updates during the process)
-		LockUpdates();
+		Phases |= EJointGraphUpdatePhase::Compile | EJointGraphUpdatePhase::NotifyNodeConnectionChanged | EJointGraphUpdatePhase::RefreshToolkitViews;
+	}
 
-		AllocateBaseNodesToJointManager();
-		
-		TryReinstancingUnknownNodeClasses();
-		
-		UpdateClassData();
-		
-		UpdateSubNodeChains();
-		
-		FeedToolkitToGraphNodes();
-		
-		BindEdNodeEvents();
-		
-		UpdateDebugData();
-		
-		CompileAllJointGraphFromRoot();
-		
-		NotifyNodeConnectionChanged();
+	PendingGraphUpdatePhases |= Phases;
+
+	++GraphUpdateStats.RequestCount;
+
+	if (GIsTransacting && GetRootGraph()) GetRootGraph()->bHasPendingTransactionCompileCheck = true;
+
+	//Undo / redo notifies the graph for every restored object - merge them into a single update after the transaction.
+	if (GIsTransacting || bDeferFlush)
+	{
+		ScheduleDeferredGraphUpdateFlush();
+		return;
+	}
+
+	FlushGraphUpdate();
+}
+
+void UJointEdGraph::ScheduleDeferredGraphUpdateFlush()
+{
+	if (bIsDeferredGraphUpdateFlushScheduled) return;
+
+	bIsDeferredGraphUpdateFlushScheduled = true;
+
+	TWeakObjectPtr<UJointEdGraph> WeakThis = this;
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis](float)
+	{
+		if (!WeakThis.IsValid()) return false;
+
+		//FlushGraphUpdate() does nothing on a locked graph - keep the pending phases and try again on the next tick instead of losing them.
+		if (GIsTransacting || WeakThis->IsLocked() || WeakThis->bIsFlushingGraphUpdate) return true;
+
+		WeakThis->bIsDeferredGraphUpdateFlushScheduled = false;
+
+		WeakThis->FlushGraphUpdate();
+
+		return false;
+	}));
+}
+
+void UJointEdGraph::FlushGraphUpdate()
+{
+	if (IsLocked() || bIsFlushingGraphUpdate) return;
+
+	const EJointGraphUpdatePhase Phases = PendingGraphUpdatePhases;
+
+	if (Phases == EJointGraphUpdatePhase::None) return;
+
+	PendingGraphUpdatePhases = EJointGraphUpdatePhase::None;
+
+	++GraphUpdateStats.FlushCount;
+
+	//Lock the graph to avoid multiple updates during the process (some instances might trigger graph updates during the process)
+	LockUpdates();
+	bIsFlushingGraphUpdate = true;
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::AllocateNodeInstances, [this]() { AllocateBaseNodesToJointManager(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::ReinstanceUnknownNodeClasses, [this]() { TryReinstancingUnknownNodeClasses(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::UpdateClassData, [this]() { UpdateClassData(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::UpdateSubNodeChains, [this]() { UpdateSubNodeChains(); });
 
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::FeedToolkit, [this]() { FeedToolkitToGraphNodes(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::BindNodeEvents, [this]() { BindEdNodeEvents(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::UpdateDebugData, [this]() { UpdateDebugData(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::Compile, [this]() { CompileDirtyJointGraphFromRoot(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::NotifyNodeConnectionChanged, [this]() { NotifyNodeConnectionChanged(); });
+
+	RunGraphUpdatePhase(Phases, EJointGraphUpdatePhase::RefreshToolkitViews, [this]()
+	{
 		if (GetToolkit().Pin())
 		{
 			GetToolkit().Pin()->RequestManagerViewerRefresh();
 			GetToolkit().Pin()->RefreshJointEditorOutliner();
 		}
-		
-		//Unlock the graph after all the updates are done.
-		UnlockUpdates();
+	});
+
+	//Unlock the graph after all the updates are done.
+	bIsFlushingGraphUpdate = false;
+	UnlockUpdates();
+}
+
+void UJointEdGraph::FlushGraphUpdateFromRoot()
+{
+	UJointEdGraph* RootGraph = GetRootGraph();
+
+	if (RootGraph == nullptr) return;
+
+	RootGraph->FlushGraphUpdate();
+
+	for (UJointEdGraph* SubGraph : RootGraph->GetAllSubGraphsRecursively())
+	{
+		if (SubGraph) SubGraph->FlushGraphUpdate();
 	}
 }
 
+void UJointEdGraph::RunGraphUpdatePhase(const EJointGraphUpdatePhase Phases, const EJointGraphUpdatePhase Phase, TFunctionRef<void()> Func)
+{
+	if (!EnumHasAnyFlags(Phases, Phase)) return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	Func();
+
+	const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+	FJointGraphUpdatePhaseStats& PhaseStats = GraphUpdateStats.Phases[FMath::FloorLog2(static_cast<uint32>(Phase))];
+
+	++PhaseStats.RunCount;
+	PhaseStats.LastTime = ElapsedTime;
+	PhaseStats.TotalTime += ElapsedTime;
+	PhaseStats.MaxTime = FMath::Max(PhaseStats.MaxTime, ElapsedTime);
+}
+
+const FJointGraphUpdateStats& UJointEdGraph::GetGraphUpdateStats() const
+{
+	return GraphUpdateStats;
+}
+
+void UJointEdGraph::ResetGraphUpdateStats()
+{
+	GraphUpdateStats = FJointGraphUpdateStats();
+}
+
+const TCHAR* FJointGraphUpdateStats::GetPhaseName(const int32 PhaseIndex)
+{
+	static const TCHAR* PhaseNames[PhaseNum] =
+	{
+		TEXT("AllocateNodeInstances"),
+		TEXT("ReinstanceUnknownNodeClasses"),
+		TEXT("UpdateClassData"),
+		TEXT("UpdateSubNodeChains"),
+		TEXT("FeedToolkit"),
+		TEXT("BindNodeEvents"),
+		TEXT("UpdateDebugData"),
+		TEXT("Compile"),
+		TEXT("NotifyNodeConnectionChanged"),
+		TEXT("RefreshToolkitViews")
+	};
+
+	return PhaseNames[FMath::Clamp(PhaseIndex, 0, PhaseNum - 1)];
+}
+
 void UJointEdGraph::ResetGraphNodeSlates()
 {
 	for (const TWeakObjectPtr<UJointEdGraphNode> GraphNode : GetCachedJointGraphNodes())
@@ -167,6 +309,8 @@ void UJointEdGraph::NotifyNodeConnectionChanged()
 
 void UJointEdGraph::RecacheNodes()
 {
+	bHasPendingNodeRecache = false;
+
 	CacheJointNodeInstances();
 	CacheJointGraphNodes();
 }
@@ -335,6 +479,49 @@ void UJointEdGraph::OnSave()
 	}
 }
 
+void UJointEdGraph::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	//Apply the deferred updates before the data is written.
+	FlushGraphUpdate();
+
+	//The root graph writes the references of the whole graphs at once.
+	if (IsRootGraph()) UpdateClassReferencesOfJointManager();
+}
+
+void UJointEdGraph::UpdateClassReferencesOfJointManager()
+{
+	if (!JointManager) return;
+
+	TSet<FString> NodeClassReferences;
+	TSet<FString> EditorNodeClassReferences;
+
+	for (UJointEdGraph* Graph : GetAllGraphsFrom(JointManager))
+	{
+		if (!Graph) continue;
+
+		for (const TWeakObjectPtr<UJointEdGraphNode>& Node : Graph->GetCachedJointGraphNodes(true))
+		{
+			if (!Node.IsValid()) continue;
+
+			EditorNodeClassReferences.Add(Node->GetClass()->GetPathName());
+
+			if (!Node->NodeClassData.GetClassName().IsEmpty())
+			{
+				NodeClassReferences.Add(FJointEdUtils::MakeNodeClassReferenceTagEntry(Node->NodeClassData));
+			}
+		}
+	}
+
+	//Keep the order stable, so saving the same asset twice doesn't produce a different tag.
+	JointManager->NodeClassReferences = NodeClassReferences.Array();
+	JointManager->NodeClassReferences.Sort();
+
+	JointManager->EditorNodeClassReferences = EditorNodeClassReferences.Array();
+	JointManager->EditorNodeClassReferences.Sort();
+}
+
 void UJointEdGraph::OnClosed()
 {
 	
@@ -342,7 +529,7 @@ void UJointEdGraph::OnClosed()
 
 void UJointEdGraph::BindEdNodeEvents()
 {
-	for (const TWeakObjectPtr<UJointEdGraphNode> GraphNode : CachedJointGraphNodes)
+	for (const TWeakObjectPtr<UJointEdGraphNode> GraphNode : GetCachedJointGraphNodes())
 	{
 		if (GraphNode.IsValid()) GraphNode->BindNodeInstance();
 	}
@@ -361,6 +548,8 @@ void UJointEdGraph::AllocateBaseNodesToJointManager()
 
 	JointManager->Nodes.Empty();
 
+	JointManager->MarkNodeTableDirty();
+
 	AllocateThisGraphBaseNodesToJointManager(JointManager, this);
 
 	TArray<UJointEdGraph*> InSubGraphs = GetAllSubGraphsRecursively();
@@ -566,7 +755,9 @@ void UJointEdGraph::ReconstructAllNodes(bool bPropagateUnder)
 		}
 	}
 
-	NotifyGraphRequestUpdate();
+	RecacheNodes();
+
+	RequestGraphUpdate(EJointGraphUpdatePhase::All, true);
 }
 
 void UJointEdGraph::ExecuteForAllNodesInHierarchy(const TFunction<void(UEdGraphNode*)>& Func)
@@ -629,6 +820,9 @@ void UJointEdGraph::CompileAllJointGraphFromRoot()
 
 	CompileResultPtr->ClearMessages();
 
+	TArray<UJointEdGraphNode*> CompiledNodes;
+	CollectJointGraphNodesForCompilation(CompiledNodes);
+
 	CompileJointGraph();
 
 	for (UJointEdGraph* SubGraph : GetAllSubGraphsRecursively())
@@ -638,11 +832,170 @@ void UJointEdGraph::CompileAllJointGraphFromRoot()
 
 	const double CompileEndTime = FPlatformTime::Seconds();
 
+	CompiledNodeSetHash = CalculateCompiledNodeSetHash(CompiledNodes);
+	bHasCompiledNodeSetHash = true;
+
+	bHasPendingTransactionCompileCheck = false;
+
 	if (OnCompileFinished.IsBound())
 		OnCompileFinished.Execute(
 			UJointEdGraph::FJointGraphCompileInfo(GetCachedJointGraphNodes().Num(), (CompileEndTime - CompileStartTime)));
 }
 
+void UJointEdGraph::CompileDirtyJointGraphFromRoot()
+{
+	if (GetRootGraph() != this)
+	{
+		GetRootGraph()->CompileDirtyJointGraphFromRoot();
+		return;
+	}
+
+	if (!CompileResultPtr) return;
+
+	const double CompileStartTime = FPlatformTime::Seconds();
+
+	TArray<UJointEdGraphNode*> GraphNodes;
+	CollectJointGraphNodesForCompilation(GraphNodes);
+
+	//Nodes have been added, removed or reordered - the cached messages can't be laid out in the same order anymore, so compile everything again.
+	if (!bHasCompiledNodeSetHash || CompiledNodeSetHash != CalculateCompiledNodeSetHash(GraphNodes))
+	{
+		CompileAllJointGraphFromRoot();
+		return;
+	}
+
+	const bool bCheckEveryNode = bHasPendingTransactionCompileCheck;
+
+	bHasPendingTransactionCompileCheck = false;
+
+	TSet<UJointEdGraphNode*> DirtyNodes;
+
+	for (UJointEdGraphNode* Node : GraphNodes)
+	{
+		//Only the nodes that have been marked since their last compilation are hashed. The hash filters out the marks that didn't change anything. (ex, moving a node)
+		if (!bCheckEveryNode && !Node->IsCompileContentDirty()) continue;
+
+		if (Node->IsCompileContentChanged()) DirtyNodes.Add(Node);
+	}
+
+	if (DirtyNodes.IsEmpty()) return;
+
+	//The nodes that refer to each node instance with their node pointer properties. Their validation relies on the node they refer to.
+	TMap<const UJointNodeBase*, TArray<UJointEdGraphNode*>> NodePointerReferrers;
+
+	TArray<UJointNodeBase*> NodePointerTargets;
+
+	for (UJointEdGraphNode* Node : GraphNodes)
+	{
+		NodePointerTargets.Reset();
+		Node->CollectNodePointerTargets(NodePointerTargets);
+
+		for (const UJointNodeBase* Target : NodePointerTargets)
+		{
+			NodePointerReferrers.FindOrAdd(Target).Add(Node);
+		}
+	}
+
+	//Compile the dirty nodes and the nodes that are directly related to them, since their compile result can rely on the dirty nodes. (ex, sub node attachment rules, pin connections, node pointers)
+	TSet<UJointEdGraphNode*> NodesToCompile = DirtyNodes;
+
+	for (UJointEdGraphNode* DirtyNode : DirtyNodes)
+	{
+		if (DirtyNode->ParentNode) NodesToCompile.Add(DirtyNode->ParentNode);
+
+		if (const TArray<UJointEdGraphNode*>* Referrers = NodePointerReferrers.Find(DirtyNode->GetCastedNodeInstance()))
+		{
+			NodesToCompile.Append(*Referrers);
+		}
+
+		for (UJointEdGraphNode* SubNode : DirtyNode->SubNodes)
+		{
+			if (SubNode) NodesToCompile.Add(SubNode);
+		}
+
+		for (const UEdGraphPin* Pin : DirtyNode->Pins)
+		{
+			if (Pin == nullptr) continue;
+
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				if (LinkedPin == nullptr) continue;
+
+				if (UJointEdGraphNode* LinkedNode = Cast<UJointEdGraphNode>(LinkedPin->GetOwningNodeUnchecked())) NodesToCompile.Add(LinkedNode);
+			}
+		}
+	}
+
+	TArray<UJointEdGraphNode*> CompilingNodes;
+
+	for (UJointEdGraphNode* Node : GraphNodes)
+	{
+		if (NodesToCompile.Contains(Node) || Node->IsCompileResultDependentOnGraph()) CompilingNodes.Add(Node);
+	}
+
+	for (UJointEdGraphNode* Node : CompilingNodes)
+	{
+		//Messages will be rebuilt from the cached ones below, in the same order as the full compilation.
+		Node->CompileNode(nullptr);
+	}
+
+	const int32 CompiledNodeCount = CompilingNodes.Num();
+
+	CompileResultPtr->ClearMessages();
+
+	for (UJointEdGraphNode* Node : GraphNodes)
+	{
+		for (const TSharedPtr<FTokenizedMessage>& TokenizedMessage : Node->CompileMessages)
+		{
+			if (TokenizedMessage.IsValid()) CompileResultPtr->AddMessage(TokenizedMessage.ToSharedRef());
+		}
+	}
+
+	const double CompileEndTime = FPlatformTime::Seconds();
+
+	if (OnCompileFinished.IsBound())
+		OnCompileFinished.Execute(
+			UJointEdGraph::FJointGraphCompileInfo(CompiledNodeCount, (CompileEndTime - CompileStartTime)));
+}
+
+void UJointEdGraph::CollectJointGraphNodesForCompilation(TArray<UJointEdGraphNode*>& OutNodes)
+{
+	TFunction<void(UJointEdGraphNode*)> CollectNode = [&OutNodes, &CollectNode](UJointEdGraphNode* Node)
+	{
+		if (Node == nullptr) return;
+
+		OutNodes.Add(Node);
+
+		for (UJointEdGraphNode* SubNode : Node->SubNodes) CollectNode(SubNode);
+	};
+
+	TArray<UJointEdGraph*> Graphs;
+	Graphs.Add(this);
+	Graphs.Append(GetAllSubGraphsRecursively());
+
+	for (UJointEdGraph* Graph : Graphs)
+	{
+		if (Graph == nullptr) continue;
+
+		for (TObjectPtr<UEdGraphNode> EdGraphNode : Graph->Nodes)
+		{
+			CollectNode(Cast<UJointEdGraphNode>(EdGraphNode));
+		}
+	}
+}
+
+uint32 UJointEdGraph::CalculateCompiledNodeSetHash(const TArray<UJointEdGraphNode*>& InNodes)
+{
+	uint32 Hash = GetTypeHash(InNodes.Num());
+
+	for (const UJointEdGraphNode* Node : InNodes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Node));
+	}
+
+	return Hash;
+}
+
 void UJointEdGraph::CompileJointGraphForNode(UJointEdGraphNode* Node, const bool bPropagateToSubNodes)
 {
 	if (Node == nullptr) return;
@@ -693,9 +1046,7 @@ UEdGraphNode* UJointEdGraph::FindGraphNodeForNodeInstance(const UObject* NodeIns
 {
 	if (NodeInstance == nullptr) return nullptr;
 
-	CacheJointGraphNodes();
-
-	for (TWeakObjectPtr<UJointEdGraphNode> CachedJointGraphNode : CachedJointGraphNodes)
+	for (TWeakObjectPtr<UJointEdGraphNode> CachedJointGraphNode : GetCachedJointGraphNodes(true))
 	{
 		if (CachedJointGraphNode == nullptr) continue;
 
@@ -707,14 +1058,28 @@ UEdGraphNode* UJointEdGraph::FindGraphNodeForNodeInstance(const UObject* NodeIns
 
 TSet<TWeakObjectPtr<UObject>> UJointEdGraph::GetCachedJointNodeInstances(const bool bForceRecache)
 {
-	if (bForceRecache || CachedJointNodeInstances.IsEmpty()) CacheJointNodeInstances();
+	if (bHasPendingNodeRecache)
+	{
+		RecacheNodes();
+	}
+	else if (bForceRecache || CachedJointNodeInstances.IsEmpty())
+	{
+		CacheJointNodeInstances();
+	}
 
 	return CachedJointNodeInstances;
 }
 
 TSet<TWeakObjectPtr<UJointEdGraphNode>> UJointEdGraph::GetCachedJointGraphNodes(const bool bForceRecache)
 {
-	if (bForceRecache || CachedJointGraphNodes.IsEmpty()) CacheJointGraphNodes();
+	if (bHasPendingNodeRecache)
+	{
+		RecacheNodes();
+	}
+	else if (bForceRecache || CachedJointGraphNodes.IsEmpty())
+	{
+		CacheJointGraphNodes();
+	}
 
 	return CachedJointGraphNodes;
 }
@@ -724,6 +1089,8 @@ void UJointEdGraph::BeginCacheForCookedPlatformData(const ITargetPlatform* Targe
 {
 	if (GetRootGraph() == this)
 	{
+		FlushGraphUpdateFromRoot();
+
 		CompileAllJointGraphFromRoot();
 	}
 
@@ -823,19 +1190,15 @@ bool UJointEdGraph::CanRemoveNestedObject(UObject* TestObject) const
 		!TestObject->IsA(UEdGraphSchema::StaticClass());
 }
 
-void UJointEdGraph::RemoveOrphanedNodes()
+void UJointEdGraph::CollectOrphanedObjects(TArray<UObject*>& OutOrphanedObjects)
 {
-	UpdateSubNodeChains();
-
-	// Obtain a list of all nodes actually in the asset and discard unused nodes
+	// Obtain a list of all nodes actually in the asset and find unused nodes
 	TArray<UObject*> AllInners;
 
 	constexpr bool bIncludeNestedObjects = false;
 
 	GetObjectsWithOuter(GetOuter(), AllInners, bIncludeNestedObjects);
 
-	uint16 count = 0;
-
 	GetCachedJointNodeInstances();
 
 	for (auto InnerIt = AllInners.CreateConstIterator(); InnerIt; ++InnerIt)
@@ -844,17 +1207,35 @@ void UJointEdGraph::RemoveOrphanedNodes()
 
 		if (!CachedJointNodeInstances.Contains(TestObject) && CanRemoveNestedObject(TestObject))
 		{
-			OnNodeInstanceRemoved(TestObject);
+			OutOrphanedObjects.Add(TestObject);
+		}
+	}
+}
+
+int32 UJointEdGraph::RemoveOrphanedNodes(const bool bFireNotification)
+{
+	UpdateSubNodeChains();
 
-			TestObject->SetFlags(RF_Transient);
-			TestObject->Rename(NULL, GetTransientPackage(),
-			                   REN_DontCreateRedirectors | REN_NonTransactional | REN_ForceNoResetLoaders);
+	TArray<UObject*> OrphanedObjects;
 
-			++count;
-		}
+	CollectOrphanedObjects(OrphanedObjects);
+
+	for (UObject* TestObject : OrphanedObjects)
+	{
+		OnNodeInstanceRemoved(TestObject);
+
+		TestObject->SetFlags(RF_Transient);
+		TestObject->Rename(NULL, GetTransientPackage(),
+		                   REN_DontCreateRedirectors | REN_NonTransactional | REN_ForceNoResetLoaders);
 	}
 
-	//Notify and mark the asset dirty.
+	const int32 count = OrphanedObjects.Num();
+
+	if (count > 0 && GetJointManager() != nullptr) GetJointManager()->MarkPackageDirty();
+
+	if (!bFireNotification) return count;
+
+	//Notify the result.
 	if (count > 0)
 	{
 		FJointEdUtils::FireNotification(
@@ -866,8 +1247,6 @@ void UJointEdGraph::RemoveOrphanedNodes()
 			EJointMDAdmonitionType::Mention,
 			4.5f
 		);
-		
-		if (GetJointManager() != nullptr) GetJointManager()->MarkPackageDirty();
 	}
 	else
 	{
@@ -881,6 +1260,8 @@ void UJointEdGraph::RemoveOrphanedNodes()
 			4.5f
 		);
 	}
+
+	return count;
 }
 
 void UJointEdGraph::OnNodeInstanceRemoved(UObject* NodeInstance)
@@ -37,6 +37,7 @@
 
 #include "Misc/EngineVersionComparison.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
 #include "Script/JointScriptSettings.h"
 
 
@@ -70,6 +71,99 @@ void FJointEdUtils::GetNodeSubClasses(const UClass* BaseClass, TArray<FJointGrap
 }
 
 
+FString FJointEdUtils::MakeNodeClassReferenceTagEntry(const FJointGraphNodeClassData& ClassData)
+{
+	//AssetName|GeneratedClassPackage|ClassName - the same fields the class data is restored with.
+	return FString::Printf(TEXT("%s|%s|%s"), *ClassData.AssetName, *ClassData.GetPackageName(), *ClassData.GetClassName());
+}
+
+//The asset registry tags are written only on save, so they can be stale for the loaded assets that have been edited since. Return the loaded Joint manager with its class references updated from its graphs, if any.
+static UJointManager* GetLoadedJointManagerWithUpdatedClassReferences(const FAssetData& AssetData)
+{
+	if (!AssetData.IsAssetLoaded()) return nullptr;
+
+	UJointManager* Manager = Cast<UJointManager>(AssetData.GetAsset());
+
+	if (!Manager) return nullptr;
+
+	UJointEdGraph* RootGraph = Cast<UJointEdGraph>(Manager->JointGraph);
+
+	if (!RootGraph) return nullptr;
+
+	RootGraph->UpdateClassReferencesOfJointManager();
+
+	return Manager;
+}
+
+bool FJointEdUtils::GetNodeClassReferencesFromAssetData(const FAssetData& AssetData, TArray<FJointGraphNodeClassData>& OutClassData)
+{
+	TArray<FString> Entries;
+
+	if (const UJointManager* Manager = GetLoadedJointManagerWithUpdatedClassReferences(AssetData))
+	{
+		Entries = Manager->NodeClassReferences;
+	}
+	else
+	{
+		FString TagValue;
+
+		if (!AssetData.GetTagValue(UJointManager::ClassReferencesVersionTagName, TagValue)) return false;
+
+		if (!AssetData.GetTagValue(UJointManager::NodeClassReferencesTagName, TagValue)) return true;
+
+		TagValue.ParseIntoArray(Entries, UJointManager::ClassReferencesTagSeparator);
+	}
+
+	for (const FString& Entry : Entries)
+	{
+		TArray<FString> Fields;
+		Entry.ParseIntoArray(Fields, TEXT("|"), false);
+
+		if (Fields.Num() != 3) continue;
+
+		OutClassData.Add(FJointGraphNodeClassData(Fields[0], Fields[1], Fields[2], nullptr));
+	}
+
+	return true;
+}
+
+bool FJointEdUtils::GetEditorNodeClassReferencesFromAssetData(const FAssetData& AssetData, TArray<FString>& OutClassPaths)
+{
+	if (const UJointManager* Manager = GetLoadedJointManagerWithUpdatedClassReferences(AssetData))
+	{
+		OutClassPaths.Append(Manager->EditorNodeClassReferences);
+
+		return true;
+	}
+
+	FString TagValue;
+
+	if (!AssetData.GetTagValue(UJointManager::ClassReferencesVersionTagName, TagValue)) return false;
+
+	if (!AssetData.GetTagValue(UJointManager::EditorNodeClassReferencesTagName, TagValue)) return true;
+
+	TagValue.ParseIntoArray(OutClassPaths, UJointManager::ClassReferencesTagSeparator);
+
+	return true;
+}
+
+bool FJointEdUtils::IsNodeClassReferenceMissing(const FJointGraphNodeClassData& ClassData)
+{
+	if (!ClassData.IsBlueprint()) return false;
+
+	//Already loaded (or not saved yet) classes are not missing.
+	if (FindObject<UClass>(nullptr, *(ClassData.GetPackageName() + TEXT(".") + ClassData.GetClassName()))) return false;
+
+	return !FPackageName::DoesPackageExist(ClassData.GetPackageName());
+}
+
+bool FJointEdUtils::IsNodeClassReferenceOf(const FJointGraphNodeClassData& ClassData, const UClass* Class)
+{
+	if (Class == nullptr || ClassData.GetClassName() != Class->GetName()) return false;
+
+	return !ClassData.IsBlueprint() || ClassData.GetPackageName() == Class->GetOutermost()->GetName();
+}
+
 FJointGraphNodeClassData FJointEdUtils::FindClassDataForNodeClass(const TSubclassOf<UJointNodeBase> NodeClass)
 {
 	TArray<FJointGraphNodeClassData> ClassData;
@@ -730,12 +824,12 @@ void FJointEdUtils::OpenFileInExplorer(const FString& FilePath)
 }
 
 void FJointEdUtils::MarkNodesAsModifiedAndValidateName(
-	TSet<UEdGraphNode*> InNodes
+	const TSet<UEdGraphNode*>& InNodes
 )
 {
 	// Modify the nodes to prepare for reattachment of sub nodes.
 
-	for (UEdGraphNode*& PreImportNode : InNodes)
+	for (UEdGraphNode* PreImportNode : InNodes)
 	{
 		if (!PreImportNode) continue;
 
@@ -773,7 +867,7 @@ void FJointEdUtils::MarkNodesAsModifiedAndValidateName(
 }
 
 
-void FJointEdUtils::MoveNodesAtLocation(TSet<UEdGraphNode*> InNodes, const FVector2D& Location)
+void FJointEdUtils::MoveNodesAtLocation(const TSet<UEdGraphNode*>& InNodes, const FVector2D& Location)
 {
 	// Recenter pasted nodes around PasteLocation
 	int64 SumX = 0, SumY = 0;
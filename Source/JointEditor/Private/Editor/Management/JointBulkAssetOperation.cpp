@@ -0,0 +1,198 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#include "Editor/Management/JointBulkAssetOperation.h"
+
+#include "FileHelpers.h"
+#include "JointEditorLogChannels.h"
+#include "JointEdUtils.h"
+#include "Markdown/SJointMDSlate_Admonitions.h"
+#include "Misc/ScopedSlowTask.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectHash.h"
+
+#define LOCTEXT_NAMESPACE "JointBulkAssetOperation"
+
+//Number of the slowest assets to write on the log.
+static constexpr int32 JointBulkAssetOperationSlowestAssetReportNum = 10;
+
+int32 FJointBulkAssetOperationResult::GetChangedAssetCount() const
+{
+	int32 Count = 0;
+
+	for (const FJointBulkAssetOperationAssetResult& AssetResult : AssetResults)
+	{
+		if (AssetResult.bChanged) ++Count;
+	}
+
+	return Count;
+}
+
+FJointBulkAssetOperation::FJointBulkAssetOperation(const FText& InOperationName, const FProcessAsset& InProcessAsset) :
+	OperationName(InOperationName),
+	ProcessAsset(InProcessAsset)
+{
+}
+
+FJointBulkAssetOperationResult FJointBulkAssetOperation::Run(const TArray<FAssetData>& Assets) const
+{
+	FJointBulkAssetOperationResult Result;
+	Result.bDryRun = bDryRun;
+
+	if (!ProcessAsset.IsBound()) return Result;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FScopedSlowTask SlowTask(Assets.Num(), bDryRun
+		? FText::Format(LOCTEXT("DryRunProgress", "{0} (Dry Run)..."), OperationName)
+		: FText::Format(LOCTEXT("RunProgress", "{0}..."), OperationName));
+
+	SlowTask.MakeDialog(true);
+
+	//Keep the changed assets alive until they are saved or the operation ends, so the garbage collection between the batches only releases the untouched ones.
+	TArray<TStrongObjectPtr<UObject>> ChangedAssets;
+
+	//Packages that were not loaded before the operation loaded them. The assets are RF_Standalone, so the garbage collection keeps them unless the flag is cleared.
+	TArray<TWeakObjectPtr<UPackage>> PackagesLoadedByOperation;
+
+	int32 BatchCount = 0;
+
+	const auto FlushBatch = [this, &ChangedAssets, &PackagesLoadedByOperation]()
+	{
+		if (bSaveChangedPackages && !ChangedAssets.IsEmpty())
+		{
+			TArray<UPackage*> Packages;
+
+			for (const TStrongObjectPtr<UObject>& ChangedAsset : ChangedAssets)
+			{
+				if (ChangedAsset.IsValid()) Packages.AddUnique(ChangedAsset->GetOutermost());
+			}
+
+			UEditorLoadingAndSavingUtils::SavePackages(Packages, true);
+
+			ChangedAssets.Reset();
+		}
+
+		if (!bCollectGarbageBetweenBatches) return;
+
+		//Release the packages that have been loaded only for this operation and have nothing left to save. The dirty ones stay loaded for the user to save them.
+		for (const TWeakObjectPtr<UPackage>& Package : PackagesLoadedByOperation)
+		{
+			if (!Package.IsValid() || Package->IsDirty()) continue;
+
+			ForEachObjectWithPackage(Package.Get(), [](UObject* Object)
+			{
+				Object->ClearFlags(RF_Standalone);
+				return true;
+			}, false);
+		}
+
+		PackagesLoadedByOperation.Reset();
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	};
+
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			Result.bCancelled = true;
+			break;
+		}
+
+		SlowTask.EnterProgressFrame(1, FText::Format(LOCTEXT("AssetProgress", "{0} : {1}"), OperationName, FText::FromName(AssetData.AssetName)));
+
+		const double AssetStartTime = FPlatformTime::Seconds();
+
+		const bool bWasAssetLoaded = AssetData.IsAssetLoaded();
+
+		UObject* Asset = AssetData.GetAsset();
+
+		if (!Asset)
+		{
+			++Result.SkippedAssetCount;
+			continue;
+		}
+
+		if (!bWasAssetLoaded) PackagesLoadedByOperation.Emplace(Asset->GetOutermost());
+
+		FJointBulkAssetOperationAssetResult AssetResult;
+		AssetResult.AssetPath = Asset->GetPathName();
+		AssetResult.bChanged = ProcessAsset.Execute(Asset, bDryRun, AssetResult.ChangeDescription);
+		AssetResult.ElapsedTime = FPlatformTime::Seconds() - AssetStartTime;
+
+		if (AssetResult.bChanged && !bDryRun) ChangedAssets.Emplace(Asset);
+
+		Result.AssetResults.Add(MoveTemp(AssetResult));
+
+		if (++BatchCount >= FMath::Max(BatchSize, 1))
+		{
+			FlushBatch();
+			BatchCount = 0;
+		}
+	}
+
+	FlushBatch();
+
+	Result.TotalTime = FPlatformTime::Seconds() - StartTime;
+
+	return Result;
+}
+
+void FJointBulkAssetOperation::ReportResult(const FJointBulkAssetOperationResult& Result) const
+{
+	const FString OperationNameString = OperationName.ToString();
+
+	for (const FJointBulkAssetOperationAssetResult& AssetResult : Result.AssetResults)
+	{
+		if (!AssetResult.bChanged) continue;
+
+		UE_LOG(LogJointEditor, Log, TEXT("%s%s : %s - %s"),
+			*OperationNameString,
+			Result.bDryRun ? TEXT(" (Dry Run)") : TEXT(""),
+			*AssetResult.AssetPath,
+			*AssetResult.ChangeDescription);
+	}
+
+	TArray<const FJointBulkAssetOperationAssetResult*> SlowestAssets;
+
+	for (const FJointBulkAssetOperationAssetResult& AssetResult : Result.AssetResults) SlowestAssets.Add(&AssetResult);
+
+	SlowestAssets.Sort([](const FJointBulkAssetOperationAssetResult& A, const FJointBulkAssetOperationAssetResult& B)
+	{
+		return A.ElapsedTime > B.ElapsedTime;
+	});
+
+	for (int32 Index = 0; Index < FMath::Min(SlowestAssets.Num(), JointBulkAssetOperationSlowestAssetReportNum); ++Index)
+	{
+		UE_LOG(LogJointEditor, Log, TEXT("%s : Slowest asset #%d : %s (%.3f ms)"),
+			*OperationNameString,
+			Index + 1,
+			*SlowestAssets[Index]->AssetPath,
+			SlowestAssets[Index]->ElapsedTime * 1000.0);
+	}
+
+	const int32 ProcessedAssetCount = Result.AssetResults.Num();
+
+	const FText SummaryText = FText::Format(
+		Result.bDryRun
+			? LOCTEXT("DryRunSummary", "{0} of {1} assets would be changed. {2} assets couldn't be loaded. Took {3} seconds (average {4} ms per asset).{5}")
+			: LOCTEXT("RunSummary", "{0} of {1} assets have been changed. {2} assets couldn't be loaded. Took {3} seconds (average {4} ms per asset).{5}"),
+		Result.GetChangedAssetCount(),
+		ProcessedAssetCount,
+		Result.SkippedAssetCount,
+		FText::AsNumber(Result.TotalTime),
+		FText::AsNumber(ProcessedAssetCount > 0 ? Result.TotalTime * 1000.0 / ProcessedAssetCount : 0.0),
+		Result.bCancelled ? LOCTEXT("CancelledSummary", " Cancelled before processing every asset.") : FText::GetEmpty());
+
+	UE_LOG(LogJointEditor, Log, TEXT("%s : %s"), *OperationNameString, *SummaryText.ToString());
+
+	FJointEdUtils::FireNotification(
+		Result.bDryRun ? FText::Format(LOCTEXT("DryRunSummaryTitle", "{0} (Dry Run)"), OperationName) : OperationName,
+		SummaryText,
+		Result.bCancelled ? EJointMDAdmonitionType::Warning : EJointMDAdmonitionType::Mention,
+		5.f,
+		false
+	);
+}
+
+#undef LOCTEXT_NAMESPACE
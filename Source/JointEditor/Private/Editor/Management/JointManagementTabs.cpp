@@ -1,6 +1,7 @@
 //Copyright 2022~2024 DevGrain. All Rights Reserved.
 
 #include "JointManagementTabs.h"
+#include "Editor/Management/JointBulkAssetOperation.h"
 
 #include "DesktopPlatformModule.h"
 #include "ISettingsEditorModule.h"
@@ -18,12 +19,14 @@
 #include "ScopedTransaction.h"
 #include "EditorTools/SJointNotificationWidget.h"
 #include "EditorWidget/SJointManagerImportingPopup.h"
+#include "Engine/Blueprint.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Markdown/SJointMDSlate_Admonitions.h"
 #include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/PackageName.h"
 #include "Script/JointScriptSettings.h"
 #include "UObject/CoreRedirects.h"
 #include "Widgets/Docking/SDockTab.h"
@@ -321,6 +324,54 @@ TSharedRef<SWidget> SJointEditorUtilityTab::CreateInvalidateSection()
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			.Padding(FJointEditorStyle::Margin_Normal)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.FillWidth(1)
+				.HAlign(HAlign_Left)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("BulkOperationDryRunExp",
+					              "Dry Run - Only report what the actions below would change, without modifying any asset. The report will be written to the output log."))
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Right)
+				.VAlign(VAlign_Center)
+				[
+					SNew(SJointOutlineToggleButton)
+					.IsChecked(this, &SJointEditorUtilityTab::GetIsBulkOperationDryRunChecked)
+					.OnCheckStateChanged(this, &SJointEditorUtilityTab::OnBulkOperationDryRunToggled)
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(FJointEditorStyle::Margin_Normal)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.FillWidth(1)
+				.HAlign(HAlign_Left)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("BulkOperationSaveChangedPackagesExp",
+					              "Save While Processing - Save the changed assets after every batch of the actions below, so they can be released from the memory. Otherwise they stay loaded until you save them."))
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.HAlign(HAlign_Right)
+				.VAlign(VAlign_Center)
+				[
+					SNew(SJointOutlineToggleButton)
+					.IsChecked(this, &SJointEditorUtilityTab::GetIsBulkOperationSaveChangedPackagesChecked)
+					.OnCheckStateChanged(this, &SJointEditorUtilityTab::OnBulkOperationSaveChangedPackagesToggled)
+				]
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(FJointEditorStyle::Margin_Normal)
 			[
 				SNew(SHorizontalBox)
 				+ SHorizontalBox::Slot()
@@ -677,24 +728,59 @@ void SJointEditorUtilityTab::OnDeveloperModeToggled(ECheckBoxState CheckBoxState
 }
 
 
+ECheckBoxState SJointEditorUtilityTab::GetIsBulkOperationDryRunChecked() const
+{
+	return bIsBulkOperationDryRun ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SJointEditorUtilityTab::OnBulkOperationDryRunToggled(ECheckBoxState CheckBoxState)
+{
+	bIsBulkOperationDryRun = CheckBoxState == ECheckBoxState::Checked;
+}
+
+ECheckBoxState SJointEditorUtilityTab::GetIsBulkOperationSaveChangedPackagesChecked() const
+{
+	return bIsBulkOperationSaveChangedPackages ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SJointEditorUtilityTab::OnBulkOperationSaveChangedPackagesToggled(ECheckBoxState CheckBoxState)
+{
+	bIsBulkOperationSaveChangedPackages = CheckBoxState == ECheckBoxState::Checked;
+}
+
 FReply SJointEditorUtilityTab::ReconstructEveryNodeInOpenedJointManagerEditor()
 {
-	TArray<UObject*> Assets = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->GetAllEditedAssets();
+	TArray<FAssetData> AssetData;
 
-	for (UObject* AllEditedAsset : Assets)
+	for (UObject* AllEditedAsset : GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->GetAllEditedAssets())
 	{
-		if (!AllEditedAsset) continue;
+		if (UJointManager* Manager = Cast<UJointManager>(AllEditedAsset)) AssetData.Add(FAssetData(Manager));
+	}
 
-		if (UJointManager* Manager = Cast<UJointManager>(AllEditedAsset))
+	FJointBulkAssetOperation Operation(
+		LOCTEXT("ReconstructOperationName", "Reconstruct Every Node"),
+		FJointBulkAssetOperation::FProcessAsset::CreateLambda([](UObject* Asset, const bool bDryRun, FString& OutChangeDescription)
 		{
-			if (!Manager || !Manager->JointGraph) continue;
+			UJointManager* Manager = Cast<UJointManager>(Asset);
 
-			UJointEdGraph* CastedGraph = Cast<UJointEdGraph>(Manager->JointGraph);
+			UJointEdGraph* CastedGraph = Manager ? Cast<UJointEdGraph>(Manager->JointGraph) : nullptr;
 
-			CastedGraph->ReconstructAllNodes(true);
-		}
-	}
+			if (!CastedGraph) return false;
+
+			const int32 NodeCount = CastedGraph->GetCachedJointGraphNodes(true).Num();
+
+			OutChangeDescription = FString::Printf(TEXT("Reconstruct %d nodes."), NodeCount);
 
+			if (!bDryRun) CastedGraph->ReconstructAllNodes(true);
+
+			return NodeCount > 0;
+		}));
+
+	//The opened assets stay loaded anyway.
+	Operation.bDryRun = bIsBulkOperationDryRun;
+	Operation.bCollectGarbageBetweenBatches = false;
+
+	Operation.ReportResult(Operation.Run(AssetData));
 
 	return FReply::Handled();
 }
@@ -705,72 +791,116 @@ FReply SJointEditorUtilityTab::CleanUpUnnecessaryNodes()
 	
 	FJointEdUtils::GetAssetOfType<UJointManager>(AssetData);
 
-	for (const FAssetData& Data : AssetData)
-	{
-		if (!Data.GetAsset()) continue;
-
-		if (UJointManager* Manager = Cast<UJointManager>(Data.GetAsset()))
+	FJointBulkAssetOperation Operation(
+		LOCTEXT("CleanUpOperationName", "Clean-up Orphaned Nodes"),
+		FJointBulkAssetOperation::FProcessAsset::CreateLambda([](UObject* Asset, const bool bDryRun, FString& OutChangeDescription)
 		{
-			if (!Manager || !Manager->JointGraph) continue;
+			UJointManager* Manager = Cast<UJointManager>(Asset);
 
-			UJointEdGraph* CastedGraph = Cast<UJointEdGraph>(Manager->JointGraph);
+			UJointEdGraph* CastedGraph = Manager ? Cast<UJointEdGraph>(Manager->JointGraph) : nullptr;
 
-			if (!CastedGraph) continue;
+			if (!CastedGraph) return false;
 
-			CastedGraph->RemoveOrphanedNodes();
-		}
-	}
+			int32 OrphanedObjectCount = 0;
+
+			if (bDryRun)
+			{
+				TArray<UObject*> OrphanedObjects;
+				CastedGraph->CollectOrphanedObjects(OrphanedObjects);
+
+				OrphanedObjectCount = OrphanedObjects.Num();
+			}
+			else
+			{
+				OrphanedObjectCount = CastedGraph->RemoveOrphanedNodes(false);
+			}
+
+			OutChangeDescription = FString::Printf(TEXT("Discard %d orphaned objects."), OrphanedObjectCount);
+
+			return OrphanedObjectCount > 0;
+		}));
+
+	Operation.bDryRun = bIsBulkOperationDryRun;
+	Operation.bSaveChangedPackages = bIsBulkOperationSaveChangedPackages;
+
+	Operation.ReportResult(Operation.Run(AssetData));
 
 	return FReply::Handled();
 }
 
 FReply SJointEditorUtilityTab::UpdateBPNodeEdSettings()
 {
-	TArray<FAssetData> AssetData;
+	TArray<FAssetData> BlueprintAssetData;
 
-	FJointEdUtils::GetAssetOfType<UBlueprint>(AssetData);
-	
-	int Count = 0;
+	FJointEdUtils::GetAssetOfType<UBlueprint>(BlueprintAssetData);
 
-	for (const FAssetData& Data : AssetData)
+	//Filter the Joint node blueprints with their native parent class tag first, so the other blueprints of the project will not be loaded.
+	TArray<FAssetData> AssetData;
+
+	for (const FAssetData& Data : BlueprintAssetData)
 	{
-		if (!Data.GetAsset()) continue;
+		FString NativeParentClassPath;
 
-		if (UBlueprint* Blueprint = Cast<UBlueprint>(Data.GetAsset()))
+		if (Data.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
 		{
-			if (Blueprint->GeneratedClass && Blueprint->GeneratedClass->IsChildOf(UJointNodeBase::StaticClass()))
-			{
-				UE_LOG(LogJointEditor, Warning, TEXT("Modifying Blueprint: %s"), *Blueprint->GetName());
+			const UClass* NativeParentClass = FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentClassPath));
+
+			if (NativeParentClass && !NativeParentClass->IsChildOf(UJointNodeBase::StaticClass())) continue;
+		}
+
+		AssetData.Add(Data);
+	}
+
+	FJointBulkAssetOperation Operation(
+		LOCTEXT("UpdateEdSettingsOperationName", "Update Joint Node Blueprint Editor Settings"),
+		FJointBulkAssetOperation::FProcessAsset::CreateLambda([](UObject* Asset, const bool bDryRun, FString& OutChangeDescription)
+		{
+			UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+
+			if (!Blueprint || !Blueprint->GeneratedClass || !Blueprint->GeneratedClass->IsChildOf(UJointNodeBase::StaticClass())) return false;
+
+			OutChangeDescription = TEXT("Move the editor node settings to the new structure and recompile.");
+
+			if (bDryRun) return true;
 
-				// 1. Blueprint의 기본 CDO (Class Default Object) 가져오기
-				UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
-				if (DefaultObject)
+			UE_LOG(LogJointEditor, Warning, TEXT("Modifying Blueprint: %s"), *Blueprint->GetName());
+
+			// 1. Blueprint의 기본 CDO (Class Default Object) 가져오기
+			UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
+			if (DefaultObject)
+			{
+				if (UJointNodeBase* Node = Cast<UJointNodeBase>(DefaultObject))
 				{
-					if (UJointNodeBase* Node = Cast<UJointNodeBase>(DefaultObject))
-					{
-						Node->EdNodeSetting.UpdateFromNode(Node);
-					}
+					Node->EdNodeSetting.UpdateFromNode(Node);
 				}
+			}
 
-				// 3. Blueprint 변경 사항을 반영하기 위해 컴파일
-				FKismetEditorUtilities::CompileBlueprint(Blueprint);
+			// 3. Blueprint 변경 사항을 반영하기 위해 컴파일
+			FKismetEditorUtilities::CompileBlueprint(Blueprint);
 
-				Blueprint->MarkPackageDirty();
+			Blueprint->MarkPackageDirty();
 
-				Count++;
-			}
-		}
-	}
+			return true;
+		}));
 
-	
-	FJointEdUtils::FireNotification(
-		LOCTEXT("UpdatedEdSettingsTitle", "Updated Editor Settings"),
-		FText::Format(
-			LOCTEXT("UpdatedEdSettings","Updated {0} Joint Node Blueprint's Editor Settings. Save your project to apply the changes."),
-			FText::FromString(FString::FromInt(Count))
-		),
-		EJointMDAdmonitionType::Mention
-	);
+	Operation.bDryRun = bIsBulkOperationDryRun;
+	Operation.bSaveChangedPackages = bIsBulkOperationSaveChangedPackages;
+
+	const FJointBulkAssetOperationResult Result = Operation.Run(AssetData);
+
+	Operation.ReportResult(Result);
+
+	if (!Result.bDryRun && !Operation.bSaveChangedPackages && Result.GetChangedAssetCount() > 0)
+	{
+		FJointEdUtils::FireNotification(
+			LOCTEXT("UpdatedEdSettingsTitle", "Updated Editor Settings"),
+			FText::Format(
+				LOCTEXT("UpdatedEdSettings","Updated {0} Joint Node Blueprint's Editor Settings. Save your project to apply the changes."),
+				FText::FromString(FString::FromInt(Result.GetChangedAssetCount()))
+			),
+			EJointMDAdmonitionType::Mention
+		);
+	}
 
 	return FReply::Handled();
 }
@@ -1539,10 +1669,44 @@ FReply SJointEditorTap_MissingClassesMap::AllocatedRedirectionRefresh()
 
 	UJointEditorSettings* Settings = UJointEditorSettings::Get();
 
+	//Read the node class references of the whole assets from the asset registry once, without loading them.
+	TArray<FAssetData> AssetData;
+	FJointEdUtils::GetAssetOfType<UJointManager>(AssetData);
+
+	TArray<TArray<FJointGraphNodeClassData>> AssetNodeClassReferences;
+	int32 UnindexedAssetCount = 0;
+
+	for (const FAssetData& Data : AssetData)
+	{
+		TArray<FJointGraphNodeClassData> NodeClassReferences;
+
+		if (FJointEdUtils::GetNodeClassReferencesFromAssetData(Data, NodeClassReferences))
+		{
+			AssetNodeClassReferences.Add(MoveTemp(NodeClassReferences));
+		}
+		else
+		{
+			++UnindexedAssetCount;
+		}
+	}
+
 	for (FJointCoreRedirect& JointCoreRedirect : Settings->JointCoreRedirects)
 	{
 		++Count;
 
+		int32 ReferencingAssetCount = 0;
+
+		for (const TArray<FJointGraphNodeClassData>& NodeClassReferences : AssetNodeClassReferences)
+		{
+			const bool bReferencesOldName = NodeClassReferences.ContainsByPredicate([&JointCoreRedirect](const FJointGraphNodeClassData& NodeClassReference)
+			{
+				return NodeClassReference.GetClassName() == JointCoreRedirect.OldName.ObjectName.ToString()
+					&& (JointCoreRedirect.OldName.PackageName.IsNone() || NodeClassReference.GetPackageName() == JointCoreRedirect.OldName.PackageName.ToString());
+			});
+
+			if (bReferencesOldName) ++ReferencingAssetCount;
+		}
+
 		RedirectionScrollBox->AddSlot()
 		                    .HAlign(HAlign_Fill)
 		                    .VAlign(VAlign_Fill)
@@ -1550,6 +1714,8 @@ FReply SJointEditorTap_MissingClassesMap::AllocatedRedirectionRefresh()
 		[
 			SNew(FJointEditorTap_RedirectionInstance)
 			.Redirection(JointCoreRedirect)
+			.ReferencingAssetCount(ReferencingAssetCount)
+			.UnindexedAssetCount(UnindexedAssetCount)
 			.Owner(SharedThis(this))
 		];
 	}
@@ -1591,8 +1757,39 @@ FReply SJointEditorTap_MissingClassesMap::MissingClassRefresh()
 
 	FJointEdUtils::GetAssetOfType<UJointManager>(AssetData);
 
+	//Many assets refer to the same classes - check each class only once.
+	TMap<FString, bool> CheckedNodeClassReferences;
+
 	for (const FAssetData& Data : AssetData)
 	{
+		TArray<FJointGraphNodeClassData> NodeClassReferences;
+
+		if (FJointEdUtils::GetNodeClassReferencesFromAssetData(Data, NodeClassReferences))
+		{
+			for (const FJointGraphNodeClassData& NodeClassReference : NodeClassReferences)
+			{
+				const FString Key = FJointEdUtils::MakeNodeClassReferenceTagEntry(NodeClassReference);
+
+				if (CheckedNodeClassReferences.Contains(Key)) continue;
+
+				const bool bIsMissing = FJointEdUtils::IsNodeClassReferenceMissing(NodeClassReference);
+
+				CheckedNodeClassReferences.Add(Key, bIsMissing);
+
+				if (!bIsMissing) continue;
+
+				const bool bAlreadyListed = FJointGraphNodeClassHelper::UnknownPackages.ContainsByPredicate([&NodeClassReference](const FJointGraphNodeClassData& UnknownPackage)
+				{
+					return UnknownPackage.GetPackageName() == NodeClassReference.GetPackageName() && UnknownPackage.GetClassName() == NodeClassReference.GetClassName();
+				});
+
+				if (!bAlreadyListed) FJointGraphNodeClassHelper::AddUnknownClass(NodeClassReference);
+			}
+
+			continue;
+		}
+
+		//The asset has been saved before the class reference tags were introduced - load it and grab the class data from its graphs.
 		if (!Data.GetAsset()) continue;
 
 		UJointManager* Manager = Cast<UJointManager>(Data.GetAsset());
@@ -1744,6 +1941,18 @@ FReply SJointEditorTap_MissingClassesMap::OnNodeClassChangeButtonClicked()
 			
 			for (const FAssetData& Data : AssetData)
 			{
+				//Don't load the assets that don't refer to the class.
+				TArray<FJointGraphNodeClassData> NodeClassReferences;
+
+				if (FJointEdUtils::GetNodeClassReferencesFromAssetData(Data, NodeClassReferences)
+					&& !NodeClassReferences.ContainsByPredicate([this](const FJointGraphNodeClassData& NodeClassReference)
+					{
+						return FJointEdUtils::IsNodeClassReferenceOf(NodeClassReference, NodeClassLeftSelectedClass.Get());
+					}))
+				{
+					continue;
+				}
+
 				UObject* Asset = Data.GetAsset();
 				if (!Asset) continue;
 
@@ -1828,6 +2037,16 @@ FReply SJointEditorTap_MissingClassesMap::OnEditorNodeClassChangeButtonClicked()
 
 			for (const FAssetData& Data : AssetData)
 			{
+				//Don't load the assets that don't refer to the class.
+				TArray<FString> EditorNodeClassReferences;
+
+				if (EditorNodeClassLeftSelectedClass
+					&& FJointEdUtils::GetEditorNodeClassReferencesFromAssetData(Data, EditorNodeClassReferences)
+					&& !EditorNodeClassReferences.Contains(EditorNodeClassLeftSelectedClass->GetPathName()))
+				{
+					continue;
+				}
+
 				UObject* Asset = Data.GetAsset();
 				if (!Asset) continue;
 
@@ -1871,6 +2090,10 @@ void FJointEditorTap_RedirectionInstance::Construct(const FArguments& InArgs)
 	Redirection = InArgs._Redirection;
 	Owner = InArgs._Owner;
 
+	const FText ReferencingAssetText = InArgs._UnindexedAssetCount > 0
+		? FText::Format(LOCTEXT("RedirectionReferencingAssetsWithUnindexed", "Referenced by {0} Joint managers. ({1} Joint managers have not been saved with the class reference tags yet and are not counted.)"), InArgs._ReferencingAssetCount, InArgs._UnindexedAssetCount)
+		: FText::Format(LOCTEXT("RedirectionReferencingAssets", "Referenced by {0} Joint managers."), InArgs._ReferencingAssetCount);
+
 	ChildSlot[
 		SNew(SJointOutlineBorder)
 		.InnerBorderImage(FJointEditorStyle::Get().GetBrush("JointUI.Border.Round"))
@@ -1889,10 +2112,21 @@ void FJointEditorTap_RedirectionInstance::Construct(const FArguments& InArgs)
 			.HAlign(HAlign_Left)
 			.VAlign(VAlign_Center)
 			[
-				SNew(STextBlock)
-				.TextStyle(FJointEditorStyle::Get(), "JointUI.TextBlock.Regular.h3")
-				.Text(FText::FromString(
-					FJointCoreRedirectObjectName::ConvertToCoreRedirectObjectName(Redirection.OldName).ToString()))
+				SNew(SVerticalBox)
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(STextBlock)
+					.TextStyle(FJointEditorStyle::Get(), "JointUI.TextBlock.Regular.h3")
+					.Text(FText::FromString(
+						FJointCoreRedirectObjectName::ConvertToCoreRedirectObjectName(Redirection.OldName).ToString()))
+				]
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(STextBlock)
+					.Text(ReferencingAssetText)
+				]
 			]
 			+ SHorizontalBox::Slot()
 			.FillWidth(1)
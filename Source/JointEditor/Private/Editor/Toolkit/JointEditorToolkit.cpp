@@ -1374,24 +1374,54 @@ void FJointEditorToolkit::OnGraphSelectedNodesChanged(UEdGraph* InGraph, const T
 	}
 }
 
-void FJointEditorToolkit::NotifySelectionChangeToNodeSlates(UEdGraph* InGraph, const TSet<class UObject*>& NewSelection) const
+void FJointEditorToolkit::NotifySelectionChangeToNodeSlates(UEdGraph* InGraph, const TSet<class UObject*>& NewSelection)
 {
 	if (JointManager == nullptr) return;
 
-	if (UJointEdGraph* CastedGraph = InGraph ? Cast<UJointEdGraph>(InGraph) : nullptr)
+	UJointEdGraph* CastedGraph = InGraph ? Cast<UJointEdGraph>(InGraph) : nullptr;
+
+	if (CastedGraph == nullptr) return;
+
+	TSet<TWeakObjectPtr<UObject>>& LastSelection = LastNotifiedGraphSelections.FindOrAdd(CastedGraph);
+
+	//Diff the selections - only the nodes that have been selected or deselected by this change need to update their slates.
+	TSet<UJointEdGraphNode*> ChangedNodes;
+
+	for (UObject* Selected : NewSelection)
+	{
+		UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(Selected);
+
+		if (CastedNode && !LastSelection.Contains(CastedNode)) ChangedNodes.Add(CastedNode);
+	}
+
+	for (const TWeakObjectPtr<UObject>& LastSelected : LastSelection)
+	{
+		UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(LastSelected.Get());
+
+		if (CastedNode && !NewSelection.Contains(CastedNode)) ChangedNodes.Add(CastedNode);
+	}
+
+	LastSelection.Reset();
+
+	for (UObject* Selected : NewSelection)
 	{
-		TSet<TWeakObjectPtr<UJointEdGraphNode>> GraphNodes = CastedGraph->GetCachedJointGraphNodes();
+		LastSelection.Add(Selected);
+	}
 
-		for (TWeakObjectPtr<UJointEdGraphNode> GraphNode : GraphNodes)
+	bool bHasDebugData = false;
+
+	for (UJointEdGraphNode* ChangedNode : ChangedNodes)
+	{
+		FOREACH_GRAPHNODESLATE_BASE_WITH(ChangedNode, NodeSlate)
 		{
-			FOREACH_GRAPHNODESLATE_BASE_WITH(GraphNode.Get(), NodeSlate)
-			{
-				NodeSlate->OnGraphSelectionChanged(NewSelection);	
-			}
+			NodeSlate->OnGraphSelectionChanged(NewSelection);	
 		}
+
+		if (!bHasDebugData && UJointDebugger::GetDebugDataForInstance(ChangedNode) != nullptr) bHasDebugData = true;
 	}
 
-	UJointDebugger::NotifyDebugDataChanged(GetJointManager());
+	//The debug data of a node can be edited on the details panel while it is selected. Clean up the debug data only when such a node has been selected or deselected.
+	if (bHasDebugData) UJointDebugger::NotifyDebugDataChanged(GetJointManager());
 }
 
 TSharedPtr<SJointGraphEditor> FJointEditorToolkit::GetFocusedGraphEditor() const
@@ -1405,6 +1435,9 @@ void FJointEditorToolkit::CompileAllJointGraphs()
 {
 	if (UJointEdGraph* MainGraph = GetMainJointGraph())
 	{
+		//Apply the deferred updates first, so the compilation sees the latest edits.
+		MainGraph->FlushGraphUpdateFromRoot();
+
 		MainGraph->CompileResultPtr->ClearMessages();
 		MainGraph->CompileAllJointGraphFromRoot();
 	}
@@ -1584,24 +1617,30 @@ void FJointEditorToolkit::CopySelectedNodes()
 	}
 	
 	
-	// Remove the nodes that are contained within other selected nodes - we only want to copy the top-level nodes
-	for (int i = NodesToCopy.Num() - 1; i >= 0; --i)
+	// Remove the nodes that are contained within other selected nodes - we only want to copy the top-level nodes.
+	// Walk up the parent chain of each node rather than expanding the whole hierarchy of every node, so it stays linear to the selection size.
+	TArray<UObject*> NestedNodesToRemove;
+
+	for (UObject* NodeToCheck : NodesToCopy)
 	{
-		UObject* NodeToCheck = NodesToCopy.Array()[i];
+		const UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(NodeToCheck);
 
-		if (UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(NodeToCheck))
+		if (CastedNode == nullptr) continue;
+
+		for (UJointEdGraphNode* Parent = CastedNode->ParentNode; Parent != nullptr; Parent = Parent->ParentNode)
 		{
-			for (UJointEdGraphNode* SubNode : CastedNode->GetAllSubNodesInHierarchy())
+			if (NodesToCopy.Contains(Parent))
 			{
-				if (NodesToCopy.Contains(SubNode))
-				{
-					NodesToCopy.Remove(SubNode);
-				}
+				NestedNodesToRemove.Add(NodeToCheck);
+				break;
 			}
 		}
 	}
-	
-		
+
+	for (UObject* NestedNode : NestedNodesToRemove)
+	{
+		NodesToCopy.Remove(NestedNode);
+	}
 	
 	for (UObject* NodeToCopy : NodesToCopy)
 	{
@@ -1716,6 +1755,9 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 	
 	// See if the newly pasted nodes can be attached to the selected node on the graph.
 	// if it's a node that had a parent node when it was copied, and we have a valid attach target node, then attach it to the target node.
+	// Nodes whose attachment has been changed after the import, and need to be post-processed again.
+	TSet<UEdGraphNode*> ReattachedNodes;
+
 	if (AttachTargetNode)
 	{
 		AttachTargetNode->Modify();
@@ -1729,12 +1771,17 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 			if (UJointEdGraphNode_Fragment* CastedPastedNode = Cast<UJointEdGraphNode_Fragment>(InEdGraphNode))
 			{
 				CastedPastedNode->ParentNode = AttachTargetNode;
-				AttachTargetNode->AddSubNode(CastedPastedNode);
+				AttachTargetNode->AddSubNode(CastedPastedNode, true);
+
+				ReattachedNodes.Add(CastedPastedNode);
 
 				// Remove the Paste Node from the graph.
 				CastedGraph->RemoveNode(CastedPastedNode);
 			}
 		}
+
+		// Update the attach target once for all the attached nodes.
+		if (!ReattachedNodes.IsEmpty()) AttachTargetNode->Update();
 	}else
 	{
 		for (UEdGraphNode* InEdGraphNode : PastedNodes)
@@ -1748,10 +1795,10 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 		}
 	}
 	
-	// Explicitly call PostProcessPastedNodes on the pasted nodes one more time since we modified attachment. (FEdGraphUtilities::ImportNodesFromText already called it once)
-	FEdGraphUtilities::PostProcessPastedNodes(PastedNodes);
+	// Explicitly call PostProcessPastedNodes one more time on the nodes whose attachment we modified. (FEdGraphUtilities::ImportNodesFromText already called it once for every pasted node)
+	if (!ReattachedNodes.IsEmpty()) FEdGraphUtilities::PostProcessPastedNodes(ReattachedNodes);
 	
-	// Notify the graph that graph nodes have been pasted.
+	// Notify the graph that graph nodes have been pasted. This is the only graph update of the paste action - the graph editor listens to it as well.
 	if (CastedGraph)
 	{
 		CastedGraph->OnNodesPasted(TextToImport);
@@ -1759,9 +1806,6 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 		CastedGraph->NotifyGraphChanged();
 	}
 
-	// Update UI
-	CurrentGraphEditor->NotifyGraphChanged();
-
 	// Mark the package as dirty
 	UObject* GraphOwner = CastedGraph->GetOuter();
 	if (GraphOwner)
@@ -1793,10 +1837,26 @@ bool FJointEditorToolkit::CanPasteNodes() const
 		return false;
 	}
 
+	UEdGraph* CurrentGraph = CurrentGraphEditor->GetCurrentGraph();
+
 	FString ClipboardContent;
 	FPlatformApplicationMisc::ClipboardPaste(ClipboardContent);
 
-	return FEdGraphUtilities::CanImportNodesFromText(CurrentGraphEditor->GetCurrentGraph(), ClipboardContent);
+	//This is evaluated whenever the menus and the commands are refreshed - hashing the text is much cheaper than parsing it, so parse it only when the clipboard has been changed.
+	const int32 ClipboardLength = ClipboardContent.Len();
+	const uint32 ClipboardHash = FCrc::MemCrc32(*ClipboardContent, ClipboardLength * sizeof(TCHAR));
+
+	if (CanPasteNodesCachedGraph.Get() != CurrentGraph
+		|| CanPasteNodesCachedClipboardLength != ClipboardLength
+		|| CanPasteNodesCachedClipboardHash != ClipboardHash)
+	{
+		CanPasteNodesCachedGraph = CurrentGraph;
+		CanPasteNodesCachedClipboardLength = ClipboardLength;
+		CanPasteNodesCachedClipboardHash = ClipboardHash;
+		bCanPasteNodesCachedResult = FEdGraphUtilities::CanImportNodesFromText(CurrentGraph, ClipboardContent);
+	}
+
+	return bCanPasteNodesCachedResult;
 }
 
 void FJointEditorToolkit::CutSelectedNodes()
@@ -1815,9 +1875,9 @@ bool FJointEditorToolkit::CanCutNodes() const
 void FJointEditorToolkit::DuplicateNodes()
 {
 	CopySelectedNodes();
-	PasteNodes();
 
-	RequestManagerViewerRefresh();
+	//PasteNodes() requests the manager viewer refresh by itself.
+	PasteNodes();
 }
 
 bool FJointEditorToolkit::CanDuplicateNodes() const
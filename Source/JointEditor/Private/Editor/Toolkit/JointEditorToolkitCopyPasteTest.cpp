@@ -0,0 +1,110 @@
+﻿//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Editor.h"
+#include "JointEdGraph.h"
+#include "JointEdGraphNode.h"
+#include "JointEditorFunctionLibrary.h"
+#include "JointEditorToolkit.h"
+#include "JointEdUtils.h"
+#include "EditorWidget/JointGraphEditor.h"
+#include "JointManager.h"
+#include "JointManagerFactory.h"
+#include "Node/Derived/JN_Foundation.h"
+
+#include "HAL/PlatformApplicationMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Copy and paste a generated graph of 1000 base nodes through the Joint editor toolkit and report how long each step takes.
+ * It goes through the same toolkit functions as the editor commands, so it covers the selection filtering, the import, the post process and the graph update of the paste.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJointEditorCopyPasteLargeSelectionTest, "Joint.Editor.CopyPaste.LargeSelection", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+static int32 CountJointBenchmarkNodes(const UJointEdGraph* Graph)
+{
+	int32 Count = 0;
+
+	for (const UEdGraphNode* Node : Graph->Nodes)
+	{
+		const UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(Node);
+
+		if (CastedNode && CastedNode->GetCastedNodeInstance() && CastedNode->GetCastedNodeInstance()->IsA<UJN_Foundation>()) ++Count;
+	}
+
+	return Count;
+}
+
+bool FJointEditorCopyPasteLargeSelectionTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumNodes = 1000;
+	constexpr int32 NumColumns = 40;
+
+	UJointManager* Manager = NewObject<UJointManager>(GetTransientPackage(), NAME_None, RF_Transactional);
+	UJointManagerFactory::CreateDefaultRootGraphForJointManager(Manager);
+
+	UJointEdGraph* Graph = Manager->GetJointGraphAs<UJointEdGraph>();
+
+	if (!TestNotNull(TEXT("Root graph"), Graph)) return false;
+
+	//Generate the nodes with the graph locked, so the graph is updated only once for all of them.
+	Graph->LockUpdates();
+
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		UJointEditorFunctionLibrary::AddBaseNode(Manager, Graph, UJN_Foundation::StaticClass(), FVector2D((Index % NumColumns) * 400.f, (Index / NumColumns) * 300.f));
+	}
+
+	Graph->UnlockUpdates();
+	Graph->NotifyGraphChanged();
+
+	TestEqual(TEXT("Generated nodes"), CountJointBenchmarkNodes(Graph), NumNodes);
+
+	FJointEditorToolkit* Toolkit = FJointEdUtils::FindOrOpenJointEditorInstanceFor(Manager, true, false);
+
+	if (!TestNotNull(TEXT("Joint editor toolkit"), Toolkit) || !TestTrue(TEXT("Focused graph editor"), Toolkit->GetFocusedGraphEditor().IsValid()))
+	{
+		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(Manager);
+
+		return false;
+	}
+
+	//The test goes through the system clipboard like the editor commands do - restore it afterward.
+	FString ClipboardBeforeTest;
+	FPlatformApplicationMisc::ClipboardPaste(ClipboardBeforeTest);
+
+	Toolkit->SelectAllNodes();
+
+	const double CopyStartTime = FPlatformTime::Seconds();
+
+	Toolkit->CopySelectedNodes();
+
+	const double CopyEndTime = FPlatformTime::Seconds();
+
+	Toolkit->GetFocusedGraphEditor()->ClearSelectionSet();
+
+	const double PasteStartTime = FPlatformTime::Seconds();
+
+	Toolkit->PasteNodesHere(FVector2D(0.f, NumNodes / NumColumns * 300.f + 1000.f));
+
+	const double PasteEndTime = FPlatformTime::Seconds();
+
+	AddInfo(FString::Printf(TEXT("%d nodes | Copy: %.2f ms, Paste: %.2f ms"),
+		NumNodes,
+		(CopyEndTime - CopyStartTime) * 1000.0,
+		(PasteEndTime - PasteStartTime) * 1000.0));
+
+	TestEqual(TEXT("Nodes after the paste"), CountJointBenchmarkNodes(Graph), NumNodes * 2);
+
+	FPlatformApplicationMisc::ClipboardCopy(*ClipboardBeforeTest);
+
+	GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->CloseAllEditorsForAsset(Manager);
+
+	return true;
+}
+
+#endif
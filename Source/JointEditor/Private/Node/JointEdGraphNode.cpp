@@ -36,6 +36,7 @@
 #include "Markdown/SJointMDSlate_Admonitions.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Modules/ModuleManager.h"
+#include "Serialization/ObjectWriter.h"
 #include "SharedType/JointEdSharedTypes.h"
 
 
@@ -751,6 +752,15 @@ void UJointEdGraphNode::NotifyGraphRequestUpdate()
 }
 
 
+void UJointEdGraphNode::PinConnectionListChanged(UEdGraphPin* Pin)
+{
+	Super::PinConnectionListChanged(Pin);
+
+	MarkCompileContentDirty();
+
+	if (UJointEdGraph* MyGraph = GetCastedGraph()) MyGraph->RequestGraphUpdate(EJointGraphUpdatePhase::ConnectionChangePhases, true);
+}
+
 void UJointEdGraphNode::NodeConnectionListChanged()
 {
 	//Notify that the connection has been changed to the node instance.
@@ -1039,9 +1049,18 @@ void UJointEdGraphNode::PostEditUndo()
 {
 	UpdateNodeInstance();
 
+	MarkCompileContentDirty();
+
 	return Super::PostEditUndo();
 }
 
+bool UJointEdGraphNode::Modify(bool bAlwaysMarkDirty)
+{
+	MarkCompileContentDirty();
+
+	return Super::Modify(bAlwaysMarkDirty);
+}
+
 void UJointEdGraphNode::DestroyNode()
 {
 	UnbindNodeInstance();
@@ -1060,6 +1079,7 @@ void UJointEdGraphNode::DestroyNode()
 			{
 				Manager->Nodes.Remove(CastedNodeInstance);
 				Manager->ManagerFragments.Remove(CastedNodeInstance);
+				Manager->MarkNodeTableDirty();
 			}
 		}
 	}
@@ -1439,6 +1459,9 @@ void UJointEdGraphNode::SyncNodeInstanceSubNodeListFromGraphNode()
 		//Propagate to the sub node.
 		InSubNode->SyncNodeInstanceSubNodeListFromGraphNode();
 	}
+
+	//The sub node list has been changed - the fragment lookup tables of this node and its parents are not valid anymore.
+	NodeBaseInstance->MarkFragmentIndexDirty();
 }
 
 void UJointEdGraphNode::UpdateSubNodeChain()
@@ -1710,6 +1733,8 @@ void UJointEdGraphNode::GrabNodeInstanceEdSettingData()
 
 void UJointEdGraphNode::ReconstructNode()
 {
+	MarkCompileContentDirty();
+
 	UpdateNodeInstance();
 
 	UpdateNodeClassData();
@@ -1722,7 +1747,8 @@ void UJointEdGraphNode::ReconstructNode()
 
 	NodeConnectionListChanged();
 
-	//if(!IsLocked()) NotifyGraphRequestUpdate();
+	//Merge the update with the other reconstructed nodes. (ex, ReconstructAllNodes())
+	if (UJointEdGraph* MyGraph = GetCastedGraph()) MyGraph->RequestGraphUpdate(EJointGraphUpdatePhase::All, true);
 }
 
 void UJointEdGraphNode::BindNodeInstancePropertyChangeEvents()
@@ -1750,16 +1776,25 @@ void UJointEdGraphNode::UnbindNodeInstancePropertyChangeEvents()
 void UJointEdGraphNode::OnNodeInstancePropertyChanged(const FPropertyChangedEvent& PropertyChangedEvent,
                                                       const FString& PropertyName)
 {
+	MarkCompileContentDirty();
+
 	UpdatePins();
 
 	NotifyNodeInstancePropertyChangeToGraphNodeWidget(PropertyChangedEvent, PropertyName);
 
 	NodeConnectionListChanged();
+
+	//Dragging a slider fires this for every step - merge them into a single update on the next tick.
+	if (UJointEdGraph* MyGraph = GetCastedGraph()) MyGraph->RequestGraphUpdate(EJointGraphUpdatePhase::PropertyChangePhases, true);
 }
 
 void UJointEdGraphNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
+	MarkCompileContentDirty();
+
 	NotifyGraphNodePropertyChangeToGraphNodeWidget(PropertyChangedEvent);
+
+	if (UJointEdGraph* MyGraph = GetCastedGraph()) MyGraph->RequestGraphUpdate(EJointGraphUpdatePhase::PropertyChangePhases, true);
 	
 	//Super::PostEditChangeProperty(PropertyChangedEvent);
 }
@@ -2187,6 +2222,12 @@ void UJointEdGraphNode::CompileNode(const TSharedPtr<class IMessageLogListing>&
 	if (!ErrorMsg.IsEmpty()) ErrorMsg.Empty();
 	bHasCompilerMessage = false;
 
+	CompiledContentHash = PendingCompileContentHash.IsSet() ? PendingCompileContentHash.GetValue() : CalculateCompileContentHash();
+	bHasCompiledContentHash = true;
+
+	PendingCompileContentHash.Reset();
+	bIsCompileContentDirty = false;
+
 	OnCompileNode();
 
 	if (CompileResultMessage.IsValid())
@@ -2254,6 +2295,116 @@ bool UJointEdGraphNode::HasCompileIssues() const
 	return CompileMessages.Num() > 0;
 }
 
+uint32 UJointEdGraphNode::CalculateCompileContentHash() const
+{
+	uint32 Hash = GetTypeHash(NodeClassData.GetClassName());
+
+	if (UObject* Instance = NodeInstance.Get())
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Instance));
+		Hash = HashCombine(Hash, GetTypeHash(Instance->GetClass()));
+
+		//Serialize the property data of the node instance, so any property change will be caught without knowing which property the node relies on.
+		TArray<uint8> InstanceData;
+		FObjectWriter Writer(Instance, InstanceData);
+
+		Hash = FCrc::MemCrc32(InstanceData.GetData(), InstanceData.Num(), Hash);
+	}
+
+	Hash = HashCombine(Hash, GetTypeHash(ParentNode.Get()));
+
+	for (const UJointEdGraphNode* SubNode : SubNodes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(SubNode));
+	}
+
+	for (const UEdGraphPin* Pin : Pins)
+	{
+		if (Pin == nullptr) continue;
+
+		Hash = HashCombine(Hash, GetTypeHash(Pin->PinName));
+
+		for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			if (LinkedPin == nullptr) continue;
+
+			Hash = HashCombine(Hash, GetTypeHash(LinkedPin->GetOwningNodeUnchecked()));
+			Hash = HashCombine(Hash, GetTypeHash(LinkedPin->PinName));
+		}
+	}
+
+	return Hash;
+}
+
+bool UJointEdGraphNode::IsCompileContentChanged() const
+{
+	const uint32 ContentHash = CalculateCompileContentHash();
+
+	if (bHasCompiledContentHash && CompiledContentHash == ContentHash)
+	{
+		//Nothing the compilation relies on has been changed - don't check the node again until it's marked again.
+		bIsCompileContentDirty = false;
+
+		return false;
+	}
+
+	//The changed nodes are compiled right after this check, so keep the hash for CompileNode().
+	PendingCompileContentHash = ContentHash;
+
+	return true;
+}
+
+void UJointEdGraphNode::MarkCompileContentDirty()
+{
+	bIsCompileContentDirty = true;
+}
+
+bool UJointEdGraphNode::IsCompileContentDirty() const
+{
+	return bIsCompileContentDirty;
+}
+
+bool UJointEdGraphNode::IsCompileResultDependentOnGraph() const
+{
+	return GetCastedNodeInstance() != nullptr && GetCastedNodeInstance()->IsCompileResultDependentOnGraph();
+}
+
+void UJointEdGraphNode::CollectNodePointerTargets(TArray<UJointNodeBase*>& OutTargets) const
+{
+	if (!GetCastedNodeInstance()) return;
+
+	for (TFieldIterator<FArrayProperty> It(NodeInstance->GetClass()); It; ++It)
+	{
+		FArrayProperty* ArrayProp = *It;
+
+		if (!ArrayProp) continue;
+
+		const FStructProperty* StructureProp = CastField<FStructProperty>(ArrayProp->Inner);
+
+		if (StructureProp == nullptr || StructureProp->Struct != FJointNodePointer::StaticStruct()) continue;
+
+		FScriptArrayHelper ArrayHelper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(NodeInstance));
+
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		{
+			const FJointNodePointer* Struct = StructureProp->ContainerPtrToValuePtr<FJointNodePointer>(ArrayHelper.GetRawPtr(Index));
+
+			if (UJointNodeBase* Target = Struct->Node.Get()) OutTargets.AddUnique(Target);
+		}
+	}
+
+	for (TFieldIterator<FStructProperty> It(NodeInstance->GetClass()); It; ++It)
+	{
+		FStructProperty* Property = *It;
+
+		if (Property == nullptr || Property->Struct != FJointNodePointer::StaticStruct()) continue;
+
+		const FJointNodePointer* Structure = Property->ContainerPtrToValuePtr<FJointNodePointer>(NodeInstance);
+
+		if (UJointNodeBase* Target = Structure->Node.Get()) OutTargets.AddUnique(Target);
+	}
+}
+
 void UJointEdGraphNode::AttachDeprecationCompilerMessage()
 {
 	const FString& DeprecationMessage = FJointGraphNodeClassHelper::GetDeprecationMessage(NodeInstance->GetClass());
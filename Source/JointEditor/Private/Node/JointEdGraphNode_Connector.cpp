@@ -511,6 +511,12 @@ void UJointEdGraphNode_Connector::OnCompileNode()
 
 }
 
+bool UJointEdGraphNode_Connector::IsCompileResultDependentOnGraph() const
+{
+	//The pair connector can be anywhere in the graph.
+	return true;
+}
+
 bool UJointEdGraphNode_Connector::CanHaveBreakpoint() const
 {
 	return false;
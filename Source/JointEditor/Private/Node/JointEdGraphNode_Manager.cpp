@@ -153,6 +153,8 @@ void UJointEdGraphNode_Manager::SyncNodeInstanceSubNodeListFromGraphNode()
 	//Refresh the sub node array from the graph node's sub nodes.
 	JointManager->ManagerFragments.Empty();
 
+	JointManager->MarkNodeTableDirty();
+
 	for (UJointEdGraphNode* SubNode : SubNodes)
 	{
 		if (SubNode == nullptr) continue;
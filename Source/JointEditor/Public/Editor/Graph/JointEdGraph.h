@@ -15,6 +15,78 @@ class FJointEditorToolkit;
 
 DECLARE_MULTICAST_DELEGATE(FOnGraphRequestUpdate);
 
+/**
+ * The phases of the graph update, in the order they are executed.
+ * Requested phases are accumulated on the graph and every pending phase runs at most once per flush.
+ * Joint 2.14.0 : introduced.
+ */
+enum class EJointGraphUpdatePhase : uint16
+{
+	None = 0,
+
+	AllocateNodeInstances = 1 << 0,
+	ReinstanceUnknownNodeClasses = 1 << 1,
+	UpdateClassData = 1 << 2,
+	UpdateSubNodeChains = 1 << 3,
+	FeedToolkit = 1 << 4,
+	BindNodeEvents = 1 << 5,
+	UpdateDebugData = 1 << 6,
+	Compile = 1 << 7,
+	NotifyNodeConnectionChanged = 1 << 8,
+	RefreshToolkitViews = 1 << 9,
+
+	//Phases that change the node data - the phases that read it will be requested along with them.
+	DataPhases = AllocateNodeInstances | ReinstanceUnknownNodeClasses | UpdateClassData | UpdateSubNodeChains,
+
+	//Phases for a property change of the graph. The nodes themselves stay the same.
+	PropertyChangePhases = UpdateDebugData | Compile | RefreshToolkitViews,
+
+	//Phases for a pin connection change. The node instances must learn about their new connections, and the connections must be validated again.
+	ConnectionChangePhases = NotifyNodeConnectionChanged | Compile | RefreshToolkitViews,
+
+	All = (1 << 10) - 1
+};
+
+ENUM_CLASS_FLAGS(EJointGraphUpdatePhase)
+
+/**
+ * Timing stats of a single graph update phase.
+ */
+struct JOINTEDITOR_API FJointGraphUpdatePhaseStats
+{
+	//How many times the phase has been executed.
+	int32 RunCount = 0;
+
+	//Elapsed time of the last execution in seconds.
+	double LastTime = 0;
+
+	//Sum of the elapsed time of every execution in seconds.
+	double TotalTime = 0;
+
+	//The longest execution in seconds.
+	double MaxTime = 0;
+};
+
+/**
+ * Stats of the graph update scheduler of a graph.
+ */
+struct JOINTEDITOR_API FJointGraphUpdateStats
+{
+	static constexpr int32 PhaseNum = 10;
+
+	//How many times the update has been requested. Requests that have been merged into another flush are counted as well.
+	int32 RequestCount = 0;
+
+	//How many times the pending phases have been flushed. (RequestCount - FlushCount) requests have been coalesced.
+	int32 FlushCount = 0;
+
+	//Per phase stats, indexed by the bit index of the EJointGraphUpdatePhase.
+	FJointGraphUpdatePhaseStats Phases[PhaseNum];
+
+	//Get the display name of the phase for the index.
+	static const TCHAR* GetPhaseName(const int32 PhaseIndex);
+};
+
 UCLASS(Blueprintable)
 class JOINTEDITOR_API UJointEdGraph : public UEdGraph
 {
@@ -164,9 +236,59 @@ public:
 	/**
 	 * Update the graph's data for the changes on its properties.
 	 * This will not do anything when the graph is locked, and also lock the graph during the process to avoid multiple updates.
+	 * Joint 2.14.0 : Same as RequestGraphUpdate(EJointGraphUpdatePhase::All). While an undo / redo transaction is being applied, the update is deferred and merged into a single update.
 	 */
 	void UpdateGraph();
 
+	/**
+	 * Request the provided phases of the graph update. Phases that read the node data will be requested along with the data phases.
+	 * The pending phases are flushed right away, except while an undo / redo transaction is being applied - in that case, every request of the transaction is merged and flushed once after it.
+	 * Requests made while the graph is locked or while the graph update itself is running are ignored, like UpdateGraph() always did.
+	 * Joint 2.14.0 : introduced.
+	 * @param Phases The phases to run.
+	 * @param bDeferFlush Whether to flush the phases on the next tick instead of right away, merging them with the other requests until then.
+	 */
+	void RequestGraphUpdate(EJointGraphUpdatePhase Phases, const bool bDeferFlush = false);
+
+	/**
+	 * Execute all the pending phases of the graph update once, in the order of EJointGraphUpdatePhase.
+	 * Joint 2.14.0 : introduced.
+	 */
+	void FlushGraphUpdate();
+
+	/**
+	 * Flush the pending graph updates of the root graph and all of its sub graphs right away.
+	 * Property changes and reconstructions defer their updates to the next tick - call this before anything that needs their result. (ex, save, compile)
+	 */
+	void FlushGraphUpdateFromRoot();
+
+	//Get the stats of the graph update scheduler.
+	const FJointGraphUpdateStats& GetGraphUpdateStats() const;
+
+	//Reset the stats of the graph update scheduler.
+	void ResetGraphUpdateStats();
+
+private:
+
+	//Flush the pending phases on the game thread later, once the current transaction has been applied and the graph has been unlocked.
+	void ScheduleDeferredGraphUpdateFlush();
+
+	//Execute the phase if it is included in the provided phases, and record its timing.
+	void RunGraphUpdatePhase(const EJointGraphUpdatePhase Phases, const EJointGraphUpdatePhase Phase, TFunctionRef<void()> Func);
+
+private:
+
+	//Phases that have been requested but not executed yet.
+	EJointGraphUpdatePhase PendingGraphUpdatePhases = EJointGraphUpdatePhase::None;
+
+	//Whether a deferred flush has been already scheduled.
+	bool bIsDeferredGraphUpdateFlushScheduled = false;
+
+	//Whether the pending phases are being executed right now.
+	bool bIsFlushingGraphUpdate = false;
+
+	FJointGraphUpdateStats GraphUpdateStats;
+
 private:
 
 	// Utility functions for the updating.
@@ -200,6 +322,15 @@ public:
 	virtual void PreDuplicate(FObjectDuplicationParameters& DupParams) override;
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 
+	// Saving Related
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+	/**
+	 * Write the node classes and the editor node classes the graphs of the Joint manager refer to, to the Joint manager's class reference properties.
+	 * Those are exposed as asset registry tags, so the missing class scan can be done without loading the assets. See UJointManager::NodeClassReferences.
+	 */
+	void UpdateClassReferencesOfJointManager();
+
 	//
 	virtual void PrepareForCopy();
 	virtual void PostCopy();
@@ -242,6 +373,14 @@ public:
 	//Compile the graph.
 	void CompileAllJointGraphFromRoot();
 
+	/**
+	 * Compile only the nodes that have been changed since the last compilation, and the nodes whose compile result relies on them.
+	 * The compile messages of the other nodes are reused from their last compilation, so the message log shows the same result as a full compilation.
+	 * Falls back to CompileAllJointGraphFromRoot() when nodes have been added to or removed from the graphs.
+	 * Joint 2.14.0 : introduced.
+	 */
+	void CompileDirtyJointGraphFromRoot();
+
 private:
 	
 	//Compile the provided graph node. Can choose whether to propagate to the children nodes.
@@ -250,6 +389,23 @@ private:
 	//Compile the graph.
 	void CompileJointGraph();
 
+	//Collect the nodes of this graph and its sub graphs in the same order the full compilation visits them.
+	void CollectJointGraphNodesForCompilation(TArray<UJointEdGraphNode*>& OutNodes);
+
+	//Calculate a hash of the node set (and its order) that has been collected with CollectJointGraphNodesForCompilation().
+	static uint32 CalculateCompiledNodeSetHash(const TArray<UJointEdGraphNode*>& InNodes);
+
+private:
+
+	//The node set hash of the last compilation. Only valid on the root graph.
+	uint32 CompiledNodeSetHash = 0;
+
+	//Whether the graph has been fully compiled at least once since it was loaded. Incremental compilation is available only after that.
+	bool bHasCompiledNodeSetHash = false;
+
+	//Whether an undo / redo transaction has requested an update since the last incremental compilation. The transaction can restore any node without marking it, so every node is checked on the next one.
+	bool bHasPendingTransactionCompileCheck = false;
+
 public:
 	
 	struct FJointGraphCompileInfo
@@ -337,6 +493,11 @@ private:
 
 	FCriticalSection CachedJointGraphNodesMutex;
 
+	/**
+	 * Whether the graph has been changed while it was locked, and the caches must be rebuilt on the next access.
+	 */
+	bool bHasPendingNodeRecache = false;
+
 public:
 	
 	virtual void OnNodesPasted(const FString& ImportStr);
@@ -345,7 +506,16 @@ public:
 	
 	virtual bool CanRemoveNestedObject(UObject* TestObject) const;
 	
-	void RemoveOrphanedNodes();
+	/**
+	 * Discard the objects under the Joint manager that are not referenced by any node of the graph.
+	 * Joint 2.14.0 : Returns the number of the discarded objects, and the notification can be turned off for the bulk operations.
+	 */
+	int32 RemoveOrphanedNodes(const bool bFireNotification = true);
+
+	/**
+	 * Collect the objects under the Joint manager that RemoveOrphanedNodes() would discard, without touching anything.
+	 */
+	void CollectOrphanedObjects(TArray<UObject*>& OutOrphanedObjects);
 	
 	virtual void OnNodeInstanceRemoved(UObject* NodeInstance);
 
@@ -92,6 +92,37 @@ public:
 	
 	}
 
+public:
+
+	/**
+	 * Make the entry of the node class reference asset registry tag for the provided class data. See UJointManager::NodeClassReferences.
+	 */
+	static FString MakeNodeClassReferenceTagEntry(const FJointGraphNodeClassData& ClassData);
+
+	/**
+	 * Read the node classes the Joint manager asset refers to from its asset registry tags, without loading the asset.
+	 * The tags are written only on save, so the references of an already loaded asset are read from its graphs instead.
+	 * @return false if the asset has been saved before the class reference tags were introduced. The asset must be loaded to get the references in that case.
+	 */
+	static bool GetNodeClassReferencesFromAssetData(const FAssetData& AssetData, TArray<FJointGraphNodeClassData>& OutClassData);
+
+	/**
+	 * Read the editor node class paths the Joint manager asset refers to from its asset registry tags, without loading the asset.
+	 * The tags are written only on save, so the references of an already loaded asset are read from its graphs instead.
+	 * @return false if the asset has been saved before the class reference tags were introduced. The asset must be loaded to get the references in that case.
+	 */
+	static bool GetEditorNodeClassReferencesFromAssetData(const FAssetData& AssetData, TArray<FString>& OutClassPaths);
+
+	/**
+	 * Check whether the class of the provided class data is missing, without loading its package. Only blueprint classes can be missing, like FJointGraphNodeClassHelper::AddUnknownClass() does.
+	 */
+	static bool IsNodeClassReferenceMissing(const FJointGraphNodeClassData& ClassData);
+
+	/**
+	 * Check whether the provided class data refers to the provided class.
+	 */
+	static bool IsNodeClassReferenceOf(const FJointGraphNodeClassData& ClassData, const UClass* Class);
+
 
 public:
 
@@ -222,9 +253,9 @@ public:
 
 public:
 	
-	static void MarkNodesAsModifiedAndValidateName(TSet<UEdGraphNode*> InNodes);
+	static void MarkNodesAsModifiedAndValidateName(const TSet<UEdGraphNode*>& InNodes);
 
-	static void MoveNodesAtLocation(TSet<UEdGraphNode*> InNodes, const FVector2D& Location);
+	static void MoveNodesAtLocation(const TSet<UEdGraphNode*>& InNodes, const FVector2D& Location);
 
 public:
 	
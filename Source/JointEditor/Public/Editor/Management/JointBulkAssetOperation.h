@@ -0,0 +1,96 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+/**
+ * The result of a single asset on the bulk asset operation.
+ */
+struct JOINTEDITOR_API FJointBulkAssetOperationAssetResult
+{
+	//Path of the processed asset.
+	FString AssetPath;
+
+	//Whether the asset has been changed. (or would have been changed, on the dry run.)
+	bool bChanged = false;
+
+	//Description of the change that the operation made or would make.
+	FString ChangeDescription;
+
+	//Time it took to load and process the asset in seconds.
+	double ElapsedTime = 0;
+};
+
+/**
+ * The result of the whole bulk asset operation.
+ */
+struct JOINTEDITOR_API FJointBulkAssetOperationResult
+{
+	TArray<FJointBulkAssetOperationAssetResult> AssetResults;
+
+	//Number of the assets that couldn't be loaded.
+	int32 SkippedAssetCount = 0;
+
+	//Whether the operation has been cancelled by the user before it processed all the assets.
+	bool bCancelled = false;
+
+	//Whether the operation ran as a dry run.
+	bool bDryRun = false;
+
+	//Total time the operation took in seconds.
+	double TotalTime = 0;
+
+public:
+
+	int32 GetChangedAssetCount() const;
+};
+
+/**
+ * A project-wide maintenance operation that processes a list of assets.
+ * Assets are processed in bounded batches under a cancellable slow task. Between the batches, the changed packages can be saved,
+ * and the packages that have been loaded only for the operation and have nothing left to save are released, so they don't stay resident until the end of the pass.
+ * It can also run as a dry run that only reports what would change.
+ */
+class JOINTEDITOR_API FJointBulkAssetOperation
+{
+public:
+
+	/**
+	 * Process a single loaded asset.
+	 * The first parameter is the asset, the second one tells whether it is a dry run - on the dry run, the asset must not be modified.
+	 * Describe the change to the third parameter, and return true if the asset has been changed (or would be changed on the dry run).
+	 */
+	DECLARE_DELEGATE_RetVal_ThreeParams(bool, FProcessAsset, UObject*, const bool, FString&);
+
+	FJointBulkAssetOperation(const FText& InOperationName, const FProcessAsset& InProcessAsset);
+
+public:
+
+	//Number of the assets to process before saving the changed packages and collecting the garbage.
+	int32 BatchSize = 32;
+
+	//If true, the assets will not be modified and the result only reports what would change.
+	bool bDryRun = false;
+
+	//Whether to save the changed packages at the end of each batch. Otherwise the changed assets are kept in memory until the operation ends, so they can be saved by the user.
+	bool bSaveChangedPackages = false;
+
+	//Whether to release the packages loaded by the operation and collect the garbage at the end of each batch. Turn it off when the assets are already loaded and referenced by something else. (ex, opened assets)
+	bool bCollectGarbageBetweenBatches = true;
+
+public:
+
+	//Run the operation on the provided assets.
+	FJointBulkAssetOperationResult Run(const TArray<FAssetData>& Assets) const;
+
+	//Write the per-asset result and timing to the log, and fire a notification with the summary.
+	void ReportResult(const FJointBulkAssetOperationResult& Result) const;
+
+private:
+
+	FText OperationName;
+
+	FProcessAsset ProcessAsset;
+};
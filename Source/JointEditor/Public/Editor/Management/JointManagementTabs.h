@@ -89,6 +89,15 @@ public:
 
 	void OnDeveloperModeToggled(ECheckBoxState CheckBoxState);
 
+public:
+	ECheckBoxState GetIsBulkOperationDryRunChecked() const;
+
+	void OnBulkOperationDryRunToggled(ECheckBoxState CheckBoxState);
+
+	ECheckBoxState GetIsBulkOperationSaveChangedPackagesChecked() const;
+
+	void OnBulkOperationSaveChangedPackagesToggled(ECheckBoxState CheckBoxState);
+
 public:
 	FReply ReconstructEveryNodeInOpenedJointManagerEditor();
 
@@ -96,6 +105,13 @@ public:
 
 	FReply UpdateBPNodeEdSettings();
 
+private:
+	//Whether the project-wide maintenance actions only report what they would change. See FJointBulkAssetOperation.
+	bool bIsBulkOperationDryRun = false;
+
+	//Whether the project-wide maintenance actions save the changed assets after every batch. See FJointBulkAssetOperation::bSaveChangedPackages.
+	bool bIsBulkOperationSaveChangedPackages = false;
+
 public:
 	FReply ResetAllEditorStyle();
 	FReply ResetGraphEditorStyle();
@@ -224,11 +240,17 @@ public:
 class JOINTEDITOR_API FJointEditorTap_RedirectionInstance : public SCompoundWidget
 {
 public:
-	SLATE_BEGIN_ARGS(FJointEditorTap_RedirectionInstance)
+	SLATE_BEGIN_ARGS(FJointEditorTap_RedirectionInstance) :
+		_ReferencingAssetCount(0),
+		_UnindexedAssetCount(0)
 		{
 		}
 
 		SLATE_ARGUMENT(FJointCoreRedirect, Redirection)
+		//Number of the Joint managers that refer to the old name of the redirection, read from the asset registry tags.
+		SLATE_ARGUMENT(int32, ReferencingAssetCount)
+		//Number of the Joint managers that don't have the class reference asset registry tags yet.
+		SLATE_ARGUMENT(int32, UnindexedAssetCount)
 		SLATE_ARGUMENT(TSharedPtr<SJointEditorTap_MissingClassesMap>, Owner)
 	SLATE_END_ARGS();
 
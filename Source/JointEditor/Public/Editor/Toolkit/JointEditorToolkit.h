@@ -217,7 +217,18 @@ public:
 
 public:
 	
-	void NotifySelectionChangeToNodeSlates(UEdGraph* InGraph, const TSet<class UObject*>& NewSelection) const;
+	/**
+	 * Notify the selection change to the slates of the nodes that have been selected or deselected by this change.
+	 * The other nodes keep their state, so they are not notified.
+	 */
+	void NotifySelectionChangeToNodeSlates(UEdGraph* InGraph, const TSet<class UObject*>& NewSelection);
+
+private:
+
+	/**
+	 * The last selection that has been notified to the node slates, for each graph.
+	 */
+	TMap<TWeakObjectPtr<UEdGraph>, TSet<TWeakObjectPtr<UObject>>> LastNotifiedGraphSelections;
 	
 public:
 
@@ -338,6 +349,18 @@ public:
 	void PasteNodesHere(const FVector2D& Location);
 	
 	bool CanPasteNodes() const;
+
+private:
+
+	/**
+	 * Cached result of CanPasteNodes(). The clipboard text is only parsed again when its content or the focused graph has been changed.
+	 */
+	mutable TWeakObjectPtr<UEdGraph> CanPasteNodesCachedGraph;
+	mutable int32 CanPasteNodesCachedClipboardLength = INDEX_NONE;
+	mutable uint32 CanPasteNodesCachedClipboardHash = 0;
+	mutable bool bCanPasteNodesCachedResult = false;
+
+public:
 	
 	void CutSelectedNodes();
 	bool CanCutNodes() const;
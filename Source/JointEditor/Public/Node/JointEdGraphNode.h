@@ -348,6 +348,11 @@ public:
 	//Triggered when the node's connections (pin) have been changed. Use this function to grab other node that are connected with the node.
 	virtual void NodeConnectionListChanged() override;
 
+	/**
+	 * Request the connection related phases of the graph update. The requests of both ends of a connection are merged into a single update.
+	 */
+	virtual void PinConnectionListChanged(UEdGraphPin* Pin) override;
+
 	/**
 	 * Allocates the node instances that this graph node refers to. By default, it allocates the owning node instance.
 	 * This function is used to get the actual node instance of the connected graph node refers to in the children graph node classes' NodeConnectionListChanged().
@@ -706,6 +711,8 @@ public:
 	virtual void PostEditImport() override;
 	virtual void PostEditUndo() override;
 
+	virtual bool Modify(bool bAlwaysMarkDirty = true) override;
+
 	virtual void ReconstructNode() override;
 	virtual void DestroyNode() override;
 
@@ -827,9 +834,64 @@ public:
 	//Return true if this node has any compile result messages to display.
 	bool HasCompileIssues() const;
 
+public:
+
+	/**
+	 * Calculate a hash of everything the compilation of this node relies on : the node instance's data, the class data, the pin connections and the node hierarchy.
+	 * The graph uses it to find out the nodes that have to be compiled again on the incremental compilation.
+	 */
+	uint32 CalculateCompileContentHash() const;
+
+	/**
+	 * Return true if the node has been changed since its last compilation, or has never been compiled.
+	 * The hash calculated for a changed node is kept for the next CompileNode() call, so the node instance is serialized only once per incremental compilation.
+	 */
+	bool IsCompileContentChanged() const;
+
+	/**
+	 * Mark the node as possibly changed, so the next incremental compilation checks its content hash.
+	 * The node marks itself on Modify(), its own and its node instance's property changes, the pin connection changes and the reconstruction.
+	 * Call this if you change the node instance in a way that doesn't go through any of them.
+	 */
+	void MarkCompileContentDirty();
+
+	//Return true if the node has been marked with MarkCompileContentDirty() since its last compilation.
+	bool IsCompileContentDirty() const;
+
+	/**
+	 * Return true if the compile result of this node relies on nodes that are not directly connected to it. (ex, connectors look for their pair over the whole graph.)
+	 * Those nodes will be compiled again on every incremental compilation.
+	 * By default, it asks the node instance. (See UJointNodeBase::IsCompileResultDependentOnGraph())
+	 * Joint 2.14.0 : introduced.
+	 */
+	virtual bool IsCompileResultDependentOnGraph() const;
+
+private:
+
+	//The compile content hash of the node on its last compilation.
+	uint32 CompiledContentHash = 0;
+
+	//Whether this node has been compiled since it was loaded. CompiledContentHash is valid only when this is true.
+	bool bHasCompiledContentHash = false;
+
+	//The content hash that IsCompileContentChanged() has calculated for the changed node. CompileNode() consumes it instead of serializing the node instance again.
+	mutable TOptional<uint32> PendingCompileContentHash;
+
+	//Whether the node has been marked as changed since its last compilation. Every node starts marked, since it has never been compiled.
+	mutable bool bIsCompileContentDirty = true;
+
 private:
 	FORCEINLINE void AttachDeprecationCompilerMessage();
 	FORCEINLINE void AttachPropertyCompilerMessage();
+
+public:
+	/**
+	 * Collect the node instances that the node pointer properties (FJointNodePointer) of the node instance refer to. Only the loaded nodes are collected.
+	 * The graph uses it to find the nodes that must be compiled again when the nodes they refer to have been changed.
+	 */
+	void CollectNodePointerTargets(TArray<UJointNodeBase*>& OutTargets) const;
+
+private:
 	FORCEINLINE void CompileAndAttachNodeInstanceCompilationMessages();
 
 public:
@@ -79,6 +79,8 @@ public:
 
 	virtual void OnCompileNode() override;
 
+	virtual bool IsCompileResultDependentOnGraph() const override;
+
 public:
 
 	virtual bool CanHaveBreakpoint() const override;
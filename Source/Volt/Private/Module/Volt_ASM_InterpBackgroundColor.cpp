@@ -5,6 +5,7 @@
 #include "VoltVariableCollection.h"
 #include "Variables/VoltVariables.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Shared/VoltInterpKernels.h"
 
 
 void UVolt_ASM_InterpBackgroundColor::Construct(const FArguments& InArgs)
@@ -44,19 +45,7 @@ void UVolt_ASM_InterpBackgroundColor::ModifySlateVariable(const float DeltaTime,
 
 		if(RateBasedInterpSpeed > 0)
 		{
-			if(bRateBasedUseConstant)
-			{
-				CastedVar->Value.R = FMath::FInterpConstantTo(CastedVar->Value.R, TargetColor.R, DeltaTime ,RateBasedInterpSpeed);
-				CastedVar->Value.G = FMath::FInterpConstantTo(CastedVar->Value.G, TargetColor.G, DeltaTime ,RateBasedInterpSpeed);
-				CastedVar->Value.B = FMath::FInterpConstantTo(CastedVar->Value.B, TargetColor.B, DeltaTime ,RateBasedInterpSpeed);
-				CastedVar->Value.A = FMath::FInterpConstantTo(CastedVar->Value.A, TargetColor.A, DeltaTime ,RateBasedInterpSpeed);
-			}else
-			{
-				CastedVar->Value.R = FMath::FInterpTo(CastedVar->Value.R, TargetColor.R, DeltaTime ,RateBasedInterpSpeed);
-				CastedVar->Value.G = FMath::FInterpTo(CastedVar->Value.G, TargetColor.G, DeltaTime ,RateBasedInterpSpeed);
-				CastedVar->Value.B = FMath::FInterpTo(CastedVar->Value.B, TargetColor.B, DeltaTime ,RateBasedInterpSpeed);
-				CastedVar->Value.A = FMath::FInterpTo(CastedVar->Value.A, TargetColor.A, DeltaTime ,RateBasedInterpSpeed);
-			}
+			FVoltInterpKernels::InterpColor(CastedVar->Value, TargetColor, DeltaTime, RateBasedInterpSpeed, bRateBasedUseConstant);
 			
 		}else
 		{
@@ -73,10 +62,7 @@ void UVolt_ASM_InterpBackgroundColor::ModifySlateVariable(const float DeltaTime,
 			AlphaBasedEaseAlpha = FMath::Clamp<double>(AccumulatedTime / AlphaBasedDuration, 0.f, 1.f);
 		}
 
-		CastedVar->Value.R = UKismetMathLibrary::Ease(StartColor.R, TargetColor.R, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.G = UKismetMathLibrary::Ease(StartColor.G, TargetColor.G, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.B = UKismetMathLibrary::Ease(StartColor.B, TargetColor.B, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.A = UKismetMathLibrary::Ease( StartColor.A, TargetColor.A, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
+		FVoltInterpKernels::EaseColor(CastedVar->Value, StartColor, TargetColor, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
 		
 		break;
 	}
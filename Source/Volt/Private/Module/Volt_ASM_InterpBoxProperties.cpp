@@ -5,6 +5,7 @@
 #include "VoltInterface.h"
 #include "VoltVariableCollection.h"
 #include "Variables/VoltVariables.h"
+#include "Shared/VoltInterpKernels.h"
 
 
 void UVolt_ASM_InterpBoxProperties::Construct(const FArguments& InArgs)
@@ -68,6 +69,10 @@ void UVolt_ASM_InterpBoxProperties::ModifySlateVariable(const float DeltaTime,
 
 	UVoltVar_Box* CastedVar = Cast<UVoltVar_Box>(Var);
 
+	//Gather the box properties into lanes, so every property can be interpolated with 2 passes of the 4-lane kernels. Only the overridden lanes will be written back.
+	double Values[8] = { CastedVar->WidthOverride, CastedVar->HeightOverride, CastedVar->MinDesiredWidth, CastedVar->MinDesiredHeight, CastedVar->MaxDesiredWidth, CastedVar->MaxDesiredHeight, CastedVar->MinAspectRatio, CastedVar->MaxAspectRatio };
+	const double Targets[8] = { TargetWidthOverride, TargetHeightOverride, TargetMinDesiredWidth, TargetMinDesiredHeight, TargetMaxDesiredWidth, TargetMaxDesiredHeight, TargetMinAspectRatio, TargetMaxAspectRatio };
+
 	//interp
 	switch (InterpolationMode)
 	{
@@ -77,60 +82,46 @@ void UVolt_ASM_InterpBoxProperties::ModifySlateVariable(const float DeltaTime,
 		{
 			if(bRateBasedUseConstant)
 			{
-				if(bOverride_WidthOverride) CastedVar->WidthOverride = FMath::FInterpConstantTo(CastedVar->WidthOverride , TargetWidthOverride, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_HeightOverride) CastedVar->HeightOverride = FMath::FInterpConstantTo(CastedVar->HeightOverride , TargetHeightOverride, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MinDesiredWidth) CastedVar->MinDesiredWidth = FMath::FInterpConstantTo(CastedVar->MinDesiredWidth , TargetMinDesiredWidth, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MinDesiredHeight) CastedVar->MinDesiredHeight = FMath::FInterpConstantTo(CastedVar->MinDesiredHeight , TargetMinDesiredHeight, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MaxDesiredWidth) CastedVar->MaxDesiredWidth = FMath::FInterpConstantTo(CastedVar->MaxDesiredWidth , TargetMaxDesiredWidth, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MaxDesiredHeight) CastedVar->MaxDesiredHeight = FMath::FInterpConstantTo(CastedVar->MaxDesiredHeight , TargetMaxDesiredHeight, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MinAspectRatio) CastedVar->MinAspectRatio = FMath::FInterpConstantTo(CastedVar->MinAspectRatio , TargetMinAspectRatio, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MaxAspectRatio) CastedVar->MaxAspectRatio = FMath::FInterpConstantTo(CastedVar->MaxAspectRatio , TargetMaxAspectRatio, DeltaTime ,RateBasedInterpSpeed);
-
+				FVoltInterpKernels::InterpConstantTo4<double>(&Values[0], &Targets[0], DeltaTime, RateBasedInterpSpeed);
+				FVoltInterpKernels::InterpConstantTo4<double>(&Values[4], &Targets[4], DeltaTime, RateBasedInterpSpeed);
 			}else
 			{
-				if(bOverride_WidthOverride) CastedVar->WidthOverride = FMath::FInterpTo(CastedVar->WidthOverride , TargetWidthOverride, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_HeightOverride) CastedVar->HeightOverride = FMath::FInterpTo(CastedVar->HeightOverride , TargetHeightOverride, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MinDesiredWidth) CastedVar->MinDesiredWidth = FMath::FInterpTo(CastedVar->MinDesiredWidth , TargetMinDesiredWidth, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MinDesiredHeight) CastedVar->MinDesiredHeight = FMath::FInterpTo(CastedVar->MinDesiredHeight , TargetMinDesiredHeight, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MaxDesiredWidth) CastedVar->MaxDesiredWidth = FMath::FInterpTo(CastedVar->MaxDesiredWidth , TargetMaxDesiredWidth, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MaxDesiredHeight) CastedVar->MaxDesiredHeight = FMath::FInterpTo(CastedVar->MaxDesiredHeight , TargetMaxDesiredHeight, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MinAspectRatio) CastedVar->MinAspectRatio = FMath::FInterpTo(CastedVar->MinAspectRatio , TargetMinAspectRatio, DeltaTime ,RateBasedInterpSpeed);
-				if(bOverride_MaxAspectRatio) CastedVar->MaxAspectRatio = FMath::FInterpTo(CastedVar->MaxAspectRatio , TargetMaxAspectRatio, DeltaTime ,RateBasedInterpSpeed);
+				FVoltInterpKernels::InterpTo4<double>(&Values[0], &Targets[0], DeltaTime, RateBasedInterpSpeed);
+				FVoltInterpKernels::InterpTo4<double>(&Values[4], &Targets[4], DeltaTime, RateBasedInterpSpeed);
 			}
 			
 		}else
 		{
-			if(bOverride_WidthOverride) CastedVar->WidthOverride = TargetWidthOverride;
-			if(bOverride_HeightOverride) CastedVar->HeightOverride = TargetHeightOverride;
-			if(bOverride_MinDesiredWidth) CastedVar->MinDesiredWidth = TargetMinDesiredWidth;
-			if(bOverride_MinDesiredHeight) CastedVar->MinDesiredHeight = TargetMinDesiredHeight;
-			if(bOverride_MaxDesiredWidth) CastedVar->MaxDesiredWidth = TargetMaxDesiredWidth;
-			if(bOverride_MaxDesiredHeight) CastedVar->MaxDesiredHeight = TargetMaxDesiredHeight;
-			if(bOverride_MinAspectRatio) CastedVar->MinAspectRatio = TargetMinAspectRatio;
-			if(bOverride_MaxAspectRatio) CastedVar->MaxAspectRatio = TargetMaxAspectRatio;
+			FMemory::Memcpy(Values, Targets, sizeof(Values));
 		}
 		
 		break;
 	case EVoltInterpMode::AlphaBased:
-		
-		if(AlphaBasedDuration > 0)
 		{
-			AccumulatedTime += DeltaTime;
+			if(AlphaBasedDuration > 0)
+			{
+				AccumulatedTime += DeltaTime;
 
-			AlphaBasedEaseAlpha = FMath::Clamp<double>(AccumulatedTime / AlphaBasedDuration, 0.f, 1.f);
-		}
+				AlphaBasedEaseAlpha = FMath::Clamp<double>(AccumulatedTime / AlphaBasedDuration, 0.f, 1.f);
+			}
 
-		if(bOverride_WidthOverride) CastedVar->WidthOverride = UKismetMathLibrary::Ease(StartWidthOverride, TargetWidthOverride, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_HeightOverride) CastedVar->HeightOverride = UKismetMathLibrary::Ease(StartHeightOverride, TargetHeightOverride, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_MinDesiredWidth) CastedVar->MinDesiredWidth = UKismetMathLibrary::Ease(StartMinDesiredWidth, TargetMinDesiredWidth, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_MinDesiredHeight) CastedVar->MinDesiredHeight = UKismetMathLibrary::Ease(StartMinDesiredHeight, TargetMinDesiredHeight, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_MaxDesiredWidth) CastedVar->MaxDesiredWidth = UKismetMathLibrary::Ease(StartMaxDesiredWidth, TargetMaxDesiredWidth, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_MaxDesiredHeight) CastedVar->MaxDesiredHeight = UKismetMathLibrary::Ease(StartMaxDesiredHeight, TargetMaxDesiredHeight, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_MinAspectRatio) CastedVar->MinAspectRatio = UKismetMathLibrary::Ease(StartMinAspectRatio, TargetMinAspectRatio, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		if(bOverride_MaxAspectRatio) CastedVar->MaxAspectRatio = UKismetMathLibrary::Ease(StartMaxAspectRatio, TargetMaxAspectRatio, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		
+			const double Starts[8] = { StartWidthOverride, StartHeightOverride, StartMinDesiredWidth, StartMinDesiredHeight, StartMaxDesiredWidth, StartMaxDesiredHeight, StartMinAspectRatio, StartMaxAspectRatio };
+			const double EasedAlpha = FVoltInterpKernels::EaseAlpha(AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
+
+			FVoltInterpKernels::Lerp4<double>(&Values[0], &Starts[0], &Targets[0], EasedAlpha);
+			FVoltInterpKernels::Lerp4<double>(&Values[4], &Starts[4], &Targets[4], EasedAlpha);
+		}
 		break;
 	}
+
+	if(bOverride_WidthOverride) CastedVar->WidthOverride = Values[0];
+	if(bOverride_HeightOverride) CastedVar->HeightOverride = Values[1];
+	if(bOverride_MinDesiredWidth) CastedVar->MinDesiredWidth = Values[2];
+	if(bOverride_MinDesiredHeight) CastedVar->MinDesiredHeight = Values[3];
+	if(bOverride_MaxDesiredWidth) CastedVar->MaxDesiredWidth = Values[4];
+	if(bOverride_MaxDesiredHeight) CastedVar->MaxDesiredHeight = Values[5];
+	if(bOverride_MinAspectRatio) CastedVar->MinAspectRatio = Values[6];
+	if(bOverride_MaxAspectRatio) CastedVar->MaxAspectRatio = Values[7];
 	
 }
 
@@ -5,6 +5,7 @@
 #include "VoltInterface.h"
 #include "VoltVariableCollection.h"
 #include "Variables/VoltVariables.h"
+#include "Shared/VoltInterpKernels.h"
 
 
 void UVolt_ASM_InterpChildSlotPadding::Construct(const FArguments& InArgs)
@@ -43,28 +44,7 @@ void UVolt_ASM_InterpChildSlotPadding::ModifySlateVariable(const float DeltaTime
 
 		if (RateBasedInterpSpeed > 0)
 		{
-			if (bRateBasedUseConstant)
-			{
-				CastedVar->Value.Bottom = FMath::FInterpConstantTo(CastedVar->Value.Bottom, TargetPadding.Bottom,
-				                                                   DeltaTime, RateBasedInterpSpeed);
-				CastedVar->Value.Top = FMath::FInterpConstantTo(CastedVar->Value.Top, TargetPadding.Top, DeltaTime,
-				                                                RateBasedInterpSpeed);
-				CastedVar->Value.Right = FMath::FInterpConstantTo(CastedVar->Value.Right, TargetPadding.Right,
-				                                                  DeltaTime, RateBasedInterpSpeed);
-				CastedVar->Value.Left = FMath::FInterpConstantTo(CastedVar->Value.Left, TargetPadding.Left, DeltaTime,
-				                                                 RateBasedInterpSpeed);
-			}
-			else
-			{
-				CastedVar->Value.Bottom = FMath::FInterpTo(CastedVar->Value.Bottom, TargetPadding.Bottom, DeltaTime,
-				                                           RateBasedInterpSpeed);
-				CastedVar->Value.Top = FMath::FInterpTo(CastedVar->Value.Top, TargetPadding.Top, DeltaTime,
-				                                        RateBasedInterpSpeed);
-				CastedVar->Value.Right = FMath::FInterpTo(CastedVar->Value.Right, TargetPadding.Right, DeltaTime,
-				                                          RateBasedInterpSpeed);
-				CastedVar->Value.Left = FMath::FInterpTo(CastedVar->Value.Left, TargetPadding.Left, DeltaTime,
-				                                         RateBasedInterpSpeed);
-			}
+			FVoltInterpKernels::InterpMargin(CastedVar->Value, TargetPadding, DeltaTime, RateBasedInterpSpeed, bRateBasedUseConstant);
 		}
 		else
 		{
@@ -81,16 +61,8 @@ void UVolt_ASM_InterpChildSlotPadding::ModifySlateVariable(const float DeltaTime
 			AlphaBasedEaseAlpha = FMath::Clamp<double>(AccumulatedTime / AlphaBasedDuration, 0.f, 1.f);
 		}
 
-		CastedVar->Value.Bottom = UKismetMathLibrary::Ease(StartPadding.Bottom, TargetPadding.Bottom,
-		                                                   AlphaBasedEaseAlpha, AlphaBasedEasingFunction,
-		                                                   AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.Top = UKismetMathLibrary::Ease(StartPadding.Top, TargetPadding.Top, AlphaBasedEaseAlpha,
-		                                                AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.Right = UKismetMathLibrary::Ease(StartPadding.Right, TargetPadding.Right, AlphaBasedEaseAlpha,
-		                                                  AlphaBasedEasingFunction, AlphaBasedBlendExp,
-		                                                  AlphaBasedSteps);
-		CastedVar->Value.Left = UKismetMathLibrary::Ease(StartPadding.Left, TargetPadding.Left, AlphaBasedEaseAlpha,
-		                                                 AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
+		FVoltInterpKernels::EaseMargin(CastedVar->Value, StartPadding, TargetPadding, AlphaBasedEaseAlpha, AlphaBasedEasingFunction,
+		                               AlphaBasedBlendExp, AlphaBasedSteps);
 		
 		break;
 	}
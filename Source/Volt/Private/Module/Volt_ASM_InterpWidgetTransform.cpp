@@ -5,6 +5,7 @@
 #include "VoltInterface.h"
 #include "VoltVariableCollection.h"
 #include "Variables/VoltVariables.h"
+#include "Shared/VoltInterpKernels.h"
 
 
 void UVolt_ASM_InterpWidgetTransform::Construct(const FArguments& InArgs)
@@ -71,15 +72,7 @@ void UVolt_ASM_InterpWidgetTransform::ModifySlateVariable(const float DeltaTime,
 			AlphaBasedEaseAlpha = FMath::Clamp<double>(AccumulatedTime / AlphaBasedDuration, 0.f, 1.f);
 		}
 
-		CastedVar->Value.Angle = UKismetMathLibrary::Ease(StartWidgetTransform.Angle, TargetWidgetTransform.Angle, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.Scale.X = UKismetMathLibrary::Ease(StartWidgetTransform.Scale.X, TargetWidgetTransform.Scale.X, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.Scale.Y = UKismetMathLibrary::Ease(StartWidgetTransform.Scale.Y, TargetWidgetTransform.Scale.Y, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-
-		CastedVar->Value.Shear.X = UKismetMathLibrary::Ease(StartWidgetTransform.Shear.X, TargetWidgetTransform.Shear.X, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.Shear.Y = UKismetMathLibrary::Ease(StartWidgetTransform.Shear.Y, TargetWidgetTransform.Shear.Y, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-
-		CastedVar->Value.Translation.X = UKismetMathLibrary::Ease(StartWidgetTransform.Translation.X, TargetWidgetTransform.Translation.X, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
-		CastedVar->Value.Translation.Y = UKismetMathLibrary::Ease(StartWidgetTransform.Translation.Y, TargetWidgetTransform.Translation.Y, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
+		FVoltInterpKernels::EaseWidgetTransform(CastedVar->Value, StartWidgetTransform, TargetWidgetTransform, AlphaBasedEaseAlpha, AlphaBasedEasingFunction, AlphaBasedBlendExp, AlphaBasedSteps);
 		
 		break;
 	}
@@ -12,6 +12,11 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SButton.h"
 
+UVoltVarAction_Opacity::UVoltVarAction_Opacity()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
+}
+
 bool UVoltVarAction_Opacity::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 {
 	return true;
@@ -19,15 +24,23 @@ bool UVoltVarAction_Opacity::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 
 void UVoltVarAction_Opacity::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_Opacity::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_Opacity* CastedVar = Cast<UVoltVar_Opacity>(Variable);
 
 	if (!CastedVar) return;
 
-	SlateToApply.Pin()->SetRenderOpacity(CastedVar->Value);
+	Widget->SetRenderOpacity(CastedVar->Value);
+}
+
+UVoltVarAction_WidgetTransform::UVoltVarAction_WidgetTransform()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
 }
 
 bool UVoltVarAction_WidgetTransform::CheckSupportWidget(TWeakPtr<SWidget> Slate)
@@ -37,15 +50,23 @@ bool UVoltVarAction_WidgetTransform::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 
 void UVoltVarAction_WidgetTransform::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_WidgetTransform::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_WidgetTransform* CastedVar = Cast<UVoltVar_WidgetTransform>(Variable);
 
 	if (!CastedVar) return;
 
-	SlateToApply.Pin()->SetRenderTransform(CastedVar->Value.ToSlateRenderTransform());
+	Widget->SetRenderTransform(CastedVar->Value.ToSlateRenderTransform());
+}
+
+UVoltVarAction_WidgetTransformPivot::UVoltVarAction_WidgetTransformPivot()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
 }
 
 bool UVoltVarAction_WidgetTransformPivot::CheckSupportWidget(TWeakPtr<SWidget> Slate)
@@ -55,15 +76,23 @@ bool UVoltVarAction_WidgetTransformPivot::CheckSupportWidget(TWeakPtr<SWidget> S
 
 void UVoltVarAction_WidgetTransformPivot::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_WidgetTransformPivot::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_WidgetTransformPivot* CastedVar = Cast<UVoltVar_WidgetTransformPivot>(Variable);
 
 	if (!CastedVar) return;
 
-	SlateToApply.Pin()->SetRenderTransformPivot(CastedVar->Value);
+	Widget->SetRenderTransformPivot(CastedVar->Value);
+}
+
+UVoltVarAction_ColorAndOpacity::UVoltVarAction_ColorAndOpacity()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
 }
 
 bool UVoltVarAction_ColorAndOpacity::CheckSupportWidget(TWeakPtr<SWidget> Slate)
@@ -82,35 +111,38 @@ bool UVoltVarAction_ColorAndOpacity::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 
 void UVoltVarAction_ColorAndOpacity::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_ColorAndOpacity::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_ColorAndOpacity* CastedVar = Cast<UVoltVar_ColorAndOpacity>(Variable);
 
 	if (!CastedVar) return;
 	
-	if (SlateToApply.Pin()->GetType() == "SImage")
+	if (Widget->GetType() == "SImage")
 	{
-		const TSharedPtr<SImage> CastedWidget = StaticCastSharedPtr<SImage>(SlateToApply.Pin());
+		const TSharedRef<SImage> CastedWidget = StaticCastSharedRef<SImage>(Widget);
 
 		CastedWidget->SetColorAndOpacity(CastedVar->Value);
 
 		return;
 	}
 
-	if (SlateToApply.Pin()->GetType() == "SBorder")
+	if (Widget->GetType() == "SBorder")
 	{
-		const TSharedPtr<SBorder> CastedWidget = StaticCastSharedPtr<SBorder>(SlateToApply.Pin());
+		const TSharedRef<SBorder> CastedWidget = StaticCastSharedRef<SBorder>(Widget);
 
 		CastedWidget->SetColorAndOpacity(CastedVar->Value);
 
 		return;
 	}
 
-	if (SlateToApply.Pin()->GetType() == "STextBlock")
+	if (Widget->GetType() == "STextBlock")
 	{
-		const TSharedPtr<STextBlock> CastedWidget = StaticCastSharedPtr<STextBlock>(SlateToApply.Pin());
+		const TSharedRef<STextBlock> CastedWidget = StaticCastSharedRef<STextBlock>(Widget);
 
 		CastedWidget->SetColorAndOpacity(CastedVar->Value);
 
@@ -118,6 +150,11 @@ void UVoltVarAction_ColorAndOpacity::ApplyVariable(UVoltVariableBase* Variable,
 	}
 }
 
+UVoltVarAction_BackgroundColor::UVoltVarAction_BackgroundColor()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
+}
+
 bool UVoltVarAction_BackgroundColor::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 {
 	if (Slate.IsValid())
@@ -132,27 +169,30 @@ bool UVoltVarAction_BackgroundColor::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 
 void UVoltVarAction_BackgroundColor::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_BackgroundColor::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_BackgroundColor* CastedVar = Cast<UVoltVar_BackgroundColor>(Variable);
 
 	if (!CastedVar) return;
 	
-	if (SlateToApply.Pin()->GetType() == "SBorder")
+	if (Widget->GetType() == "SBorder")
 	{
-		const TSharedPtr<SBorder> CastedWidget = StaticCastSharedPtr<SBorder>(SlateToApply.Pin());
+		const TSharedRef<SBorder> CastedWidget = StaticCastSharedRef<SBorder>(Widget);
 
 		CastedWidget->SetBorderBackgroundColor(CastedVar->Value);
 		
 		return;
 	}
 
-	if (SlateToApply.Pin()->GetType() == "SButton")
+	if (Widget->GetType() == "SButton")
 	{
 		
-		const TSharedPtr<SButton> CastedWidget = StaticCastSharedPtr<SButton>(SlateToApply.Pin());
+		const TSharedRef<SButton> CastedWidget = StaticCastSharedRef<SButton>(Widget);
 
 		CastedWidget->SetBorderBackgroundColor(CastedVar->Value);
 		
@@ -160,6 +200,11 @@ void UVoltVarAction_BackgroundColor::ApplyVariable(UVoltVariableBase* Variable,
 	}
 }
 
+UVoltVarAction_ForegroundColor::UVoltVarAction_ForegroundColor()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
+}
+
 bool UVoltVarAction_ForegroundColor::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 {
 	if (Slate.IsValid())
@@ -174,27 +219,30 @@ bool UVoltVarAction_ForegroundColor::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 
 void UVoltVarAction_ForegroundColor::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_ForegroundColor::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_BackgroundColor* CastedVar = Cast<UVoltVar_BackgroundColor>(Variable);
 
 	if (!CastedVar) return;
 	
-	if (SlateToApply.Pin()->GetType() == "SBorder")
+	if (Widget->GetType() == "SBorder")
 	{
-		const TSharedPtr<SBorder> CastedWidget = StaticCastSharedPtr<SBorder>(SlateToApply.Pin());
+		const TSharedRef<SBorder> CastedWidget = StaticCastSharedRef<SBorder>(Widget);
 
 		CastedWidget->SetForegroundColor(CastedVar->Value);
 		
 		return;
 	}
 
-	if (SlateToApply.Pin()->GetType() == "SButton")
+	if (Widget->GetType() == "SButton")
 	{
 		
-		const TSharedPtr<SButton> CastedWidget = StaticCastSharedPtr<SButton>(SlateToApply.Pin());
+		const TSharedRef<SButton> CastedWidget = StaticCastSharedRef<SButton>(Widget);
 
 		CastedWidget->SetForegroundColor(CastedVar->Value);
 		
@@ -204,6 +252,11 @@ void UVoltVarAction_ForegroundColor::ApplyVariable(UVoltVariableBase* Variable,
 	
 }
 
+UVoltVarAction_ChildSlotPadding::UVoltVarAction_ChildSlotPadding()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
+}
+
 bool UVoltVarAction_ChildSlotPadding::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 {
 	if (Slate.IsValid())
@@ -219,26 +272,29 @@ bool UVoltVarAction_ChildSlotPadding::CheckSupportWidget(TWeakPtr<SWidget> Slate
 
 void UVoltVarAction_ChildSlotPadding::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_ChildSlotPadding::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_ChildSlotPadding* CastedVar = Cast<UVoltVar_ChildSlotPadding>(Variable);
 
 	if (!CastedVar) return;
 	
-	if (SlateToApply.Pin()->GetType() == "SBorder")
+	if (Widget->GetType() == "SBorder")
 	{
-		const TSharedPtr<SBorder> CastedWidget = StaticCastSharedPtr<SBorder>(SlateToApply.Pin());
+		const TSharedRef<SBorder> CastedWidget = StaticCastSharedRef<SBorder>(Widget);
 
 		CastedWidget->SetPadding(CastedVar->Value);
 		
 		return;
 	}
 
-	if (SlateToApply.Pin()->GetType() == "SHorizontalBox")
+	if (Widget->GetType() == "SHorizontalBox")
 	{
-		const TSharedPtr<SHorizontalBox> CastedWidget = StaticCastSharedPtr<SHorizontalBox>(SlateToApply.Pin());
+		const TSharedRef<SHorizontalBox> CastedWidget = StaticCastSharedRef<SHorizontalBox>(Widget);
 
 		const int SlotNum = CastedWidget->NumSlots();
 		
@@ -252,9 +308,9 @@ void UVoltVarAction_ChildSlotPadding::ApplyVariable(UVoltVariableBase* Variable,
 		return;
 	}
 
-	if (SlateToApply.Pin()->GetType() == "SVerticalBox")
+	if (Widget->GetType() == "SVerticalBox")
 	{
-		const TSharedPtr<SVerticalBox> CastedWidget = StaticCastSharedPtr<SVerticalBox>(SlateToApply.Pin());
+		const TSharedRef<SVerticalBox> CastedWidget = StaticCastSharedRef<SVerticalBox>(Widget);
 
 		const int SlotNum = CastedWidget->NumSlots();
 		
@@ -269,6 +325,11 @@ void UVoltVarAction_ChildSlotPadding::ApplyVariable(UVoltVariableBase* Variable,
 	}
 }
 
+UVoltVarAction_ParentSlotPadding::UVoltVarAction_ParentSlotPadding()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
+}
+
 bool UVoltVarAction_ParentSlotPadding::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 {
 	if (Slate.IsValid())
@@ -286,18 +347,20 @@ bool UVoltVarAction_ParentSlotPadding::CheckSupportWidget(TWeakPtr<SWidget> Slat
 
 void UVoltVarAction_ParentSlotPadding::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-		
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_ParentSlotPadding::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_ParentSlotPadding* CastedVar = Cast<UVoltVar_ParentSlotPadding>(Variable);
 	
 	if (!CastedVar) return;
 	
-	TSharedPtr<SWidget> ParentSlate = SlateToApply.Pin()->GetParentWidget();
+	TSharedPtr<SWidget> ParentSlate = Widget->GetParentWidget();
 
-	if (SlateToApply.Pin()->GetParentWidget() == nullptr) return;
+	if (Widget->GetParentWidget() == nullptr) return;
 	
 	if (ParentSlate->GetType() == "SBorder")
 	{
@@ -318,7 +381,7 @@ void UVoltVarAction_ParentSlotPadding::ApplyVariable(UVoltVariableBase* Variable
 		{
 			SHorizontalBox::FSlot* Slot = &CastedParentWidget->GetSlot(Index);
 
-			if (Slot->GetWidget() != SlateToApply) continue;
+			if (Slot->GetWidget() != Widget) continue;
 
 			Slot->SetPadding(CastedVar->Value);
 
@@ -338,7 +401,7 @@ void UVoltVarAction_ParentSlotPadding::ApplyVariable(UVoltVariableBase* Variable
 		{
 			SVerticalBox::FSlot* Slot = &CastedParentWidget->GetSlot(Index);
 
-			if (Slot->GetWidget() != SlateToApply) continue;
+			if (Slot->GetWidget() != Widget) continue;
 
 			Slot->SetPadding(CastedVar->Value);
 
@@ -361,7 +424,7 @@ void UVoltVarAction_ParentSlotPadding::ApplyVariable(UVoltVariableBase* Variable
 		{
 			SScrollBox::FSlot* Slot = &(*Slots)[Index];
 
-			if (Slot->GetWidget() != SlateToApply) continue;
+			if (Slot->GetWidget() != Widget) continue;
 
 			Slot->SetPadding(CastedVar->Value);
 
@@ -385,7 +448,7 @@ void UVoltVarAction_ParentSlotPadding::ApplyVariable(UVoltVariableBase* Variable
 		{
 			SWrapBox::FSlot* Slot = &(*Slots)[Index];
 
-			if (Slot->GetWidget() != SlateToApply) continue;
+			if (Slot->GetWidget() != Widget) continue;
 
 			Slot->SetPadding(CastedVar->Value);
 
@@ -397,6 +460,11 @@ void UVoltVarAction_ParentSlotPadding::ApplyVariable(UVoltVariableBase* Variable
 }
 
 
+UVoltVarAction_Box::UVoltVarAction_Box()
+{
+	bSupportDependsOnWidgetTypeOnly = true;
+}
+
 bool UVoltVarAction_Box::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 {
 	if (Slate.IsValid())
@@ -410,17 +478,20 @@ bool UVoltVarAction_Box::CheckSupportWidget(TWeakPtr<SWidget> Slate)
 
 void UVoltVarAction_Box::ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply)
 {
-	if (!SlateToApply.IsValid()) return;
+	if (const TSharedPtr<SWidget> Slate = SlateToApply.Pin()) ApplyVariableToWidget(Variable, Slate.ToSharedRef());
+}
 
+void UVoltVarAction_Box::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
 	if (!Variable) return;
 
 	UVoltVar_Box* CastedVar = Cast<UVoltVar_Box>(Variable);
 
 	if (!CastedVar) return;
 	
-	if (SlateToApply.Pin()->GetType() == "SBox")
+	if (Widget->GetType() == "SBox")
 	{
-		const TSharedPtr<SBox> CastedParentWidget = StaticCastSharedPtr<SBox>(SlateToApply.Pin());
+		const TSharedRef<SBox> CastedParentWidget = StaticCastSharedRef<SBox>(Widget);
 
 		if(CastedVar->bOverride_HeightOverride) CastedParentWidget->SetHeightOverride(CastedVar->HeightOverride);
 		if(CastedVar->bOverride_WidthOverride) CastedParentWidget->SetWidthOverride(CastedVar->WidthOverride);
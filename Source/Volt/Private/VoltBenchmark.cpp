@@ -0,0 +1,332 @@
+﻿//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "VoltDecl.h"
+#include "VoltSettings.h"
+#include "Module/Volt_ASM_Delay.h"
+#include "Module/Volt_ASM_InterpBackgroundColor.h"
+#include "Module/Volt_ASM_InterpRenderOpacity.h"
+#include "Module/Volt_ASM_InterpWidgetTransform.h"
+#include "Module/Volt_ASM_Sequence.h"
+#include "Module/Volt_ASM_Simultaneous.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/OutputDevice.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/UObjectArray.h"
+#include "Widgets/Layout/SBorder.h"
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+/**
+ * The measurement of a single benchmark pass.
+ */
+struct FVoltBenchmarkResult
+{
+	double TotalFrameMs = 0;
+	double MaxFrameMs = 0;
+	double GameThreadMs = 0;
+	int32 MinTracks = MAX_int32;
+	int32 MaxTracks = 0;
+
+	//Whether the allocator reports the allocated bytes. The allocation fields are meaningless if it doesn't.
+	bool bHasAllocatorStats = false;
+
+	//The net change of the bytes held by the allocator over the whole run, and the largest net change within a single frame.
+	int64 AllocatedBytesDelta = 0;
+	int64 MaxFrameAllocatedBytesDelta = 0;
+
+	//The number of the frames that left the allocator holding more bytes than before the frame.
+	int32 NumFramesWithAllocatorGrowth = 0;
+
+	int32 ObjectCountDelta = 0;
+};
+
+/**
+ * Return the bytes the allocator has handed out at the moment, or INDEX_NONE if the allocator doesn't report it.
+ * Unlike the used physical memory of the process, this is not affected by the pages the allocator caches or releases to the OS. (FMallocBinned2 reports it when its allocator stats are enabled.)
+ */
+static int64 GetVoltBenchmarkAllocatedBytes()
+{
+	if (GMalloc == nullptr) return INDEX_NONE;
+
+	FGenericMemoryStats Stats;
+	GMalloc->GetAllocatorStats(Stats);
+
+	const SIZE_T* TotalAllocated = Stats.Data.Find(TEXT("TotalAllocated"));
+
+	return TotalAllocated ? static_cast<int64>(*TotalAllocated) : INDEX_NONE;
+}
+
+static const UVoltAnimation* MakeVoltBenchmarkAnimation()
+{
+	return VOLT_MAKE_ANIMATION()
+	(
+		VOLT_MAKE_MODULE(UVolt_ASM_Sequence)
+		(
+			VOLT_MAKE_MODULE(UVolt_ASM_Delay)
+			.Duration(0.05),
+			VOLT_MAKE_MODULE(UVolt_ASM_Simultaneous)
+			(
+				VOLT_MAKE_MODULE(UVolt_ASM_InterpWidgetTransform)
+				.InterpolationMode(EVoltInterpMode::AlphaBased)
+				.AlphaBasedDuration(0.3)
+				.AlphaBasedEasingFunction(EEasingFunc::ExpoOut)
+				.AlphaBasedBlendExp(6)
+				.TargetWidgetTransform(FWidgetTransform(FVector2D(0, -4), FVector2D(1.1, 1.1), FVector2D::ZeroVector, 0)),
+				VOLT_MAKE_MODULE(UVolt_ASM_InterpBackgroundColor)
+				.TargetColor(FLinearColor(0.2, 0.4, 0.8, 1))
+				.RateBasedInterpSpeed(10),
+				VOLT_MAKE_MODULE(UVolt_ASM_InterpRenderOpacity)
+				.InterpolationMode(EVoltInterpMode::AlphaBased)
+				.AlphaBasedDuration(0.3)
+				.TargetOpacity(0.5)
+			),
+			VOLT_MAKE_MODULE(UVolt_ASM_Simultaneous)
+			(
+				VOLT_MAKE_MODULE(UVolt_ASM_InterpWidgetTransform)
+				.InterpolationMode(EVoltInterpMode::AlphaBased)
+				.AlphaBasedDuration(0.3)
+				.AlphaBasedEasingFunction(EEasingFunc::ExpoOut)
+				.AlphaBasedBlendExp(6)
+				.TargetWidgetTransform(FWidgetTransform(FVector2D::ZeroVector, FVector2D(1, 1), FVector2D::ZeroVector, 0)),
+				VOLT_MAKE_MODULE(UVolt_ASM_InterpBackgroundColor)
+				.TargetColor(FLinearColor(1, 1, 1, 1))
+				.RateBasedInterpSpeed(10),
+				VOLT_MAKE_MODULE(UVolt_ASM_InterpRenderOpacity)
+				.InterpolationMode(EVoltInterpMode::AlphaBased)
+				.AlphaBasedDuration(0.3)
+				.TargetOpacity(1)
+			)
+		)
+	);
+}
+
+static FVoltBenchmarkResult RunVoltBenchmarkPass(UVoltSubsystem* Subsystem, const int32 NumSlates, const int32 NumFrames, const float DeltaTime)
+{
+	FVoltBenchmarkResult Result;
+
+	TArray<TSharedRef<SBorder>> Slates;
+	TArray<TScriptInterface<IVoltInterface>> VoltInterfaces;
+	TArray<FVoltAnimationTrack> Tracks;
+
+	Slates.Reserve(NumSlates);
+	VoltInterfaces.Reserve(NumSlates);
+	Tracks.Reserve(NumSlates);
+
+	for (int32 Index = 0; Index < NumSlates; ++Index)
+	{
+		const TSharedRef<SBorder> Slate = SNew(SBorder);
+
+		Slates.Add(Slate);
+		VoltInterfaces.Add(VOLT_FIND_OR_ASSIGN_INTERFACE_FOR(Slate));
+	}
+
+	//Use a dedicated manager with a valid outer, so the subsystem doesn't discard it in the middle of the run.
+	UVoltAnimationManager* AnimationManager = nullptr;
+	VOLT_IMPLEMENT_MANAGER(&AnimationManager, GetTransientPackage());
+
+	if (AnimationManager == nullptr) return Result;
+
+	AnimationManager->AddToRoot();
+
+	const UVoltAnimation* Animation = MakeVoltBenchmarkAnimation();
+
+	for (const TScriptInterface<IVoltInterface>& VoltInterface : VoltInterfaces)
+	{
+		Tracks.Add(AnimationManager->PlayAnimationFor(VoltInterface, Animation));
+	}
+
+	const int64 AllocatedBytesAtStart = GetVoltBenchmarkAllocatedBytes();
+	const int32 ObjectCountAtStart = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	Result.bHasAllocatorStats = AllocatedBytesAtStart != INDEX_NONE;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		//Tag the frames, so the allocations can be broken down with LLM (-llm) or Unreal Insights (-trace=cpu,memory) on the same run.
+		LLM_SCOPE_BYNAME(TEXT("Volt/Benchmark"));
+		TRACE_CPUPROFILER_EVENT_SCOPE(VoltBenchmarkFrame);
+
+		const int64 FrameStartAllocatedBytes = Result.bHasAllocatorStats ? GetVoltBenchmarkAllocatedBytes() : 0;
+
+		const uint64 FrameStartCycles = FPlatformTime::Cycles64();
+
+		//Play the animation again for the slates whose track has been finished.
+		for (int32 Index = 0; Index < Tracks.Num(); ++Index)
+		{
+			if (!AnimationManager->HasTrack(Tracks[Index])) Tracks[Index] = AnimationManager->PlayAnimationFor(VoltInterfaces[Index], Animation);
+		}
+
+		Subsystem->UpdateAnimations(DeltaTime);
+
+		const uint64 GameThreadEndCycles = FPlatformTime::Cycles64();
+
+		//Wait for the module update thread, so every frame includes the whole module update.
+		while (Subsystem->IsModuleUpdateThreadWorking())
+		{
+			FPlatformProcess::Yield();
+		}
+
+		const double FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+
+		if (Result.bHasAllocatorStats)
+		{
+			const int64 FrameAllocatedBytesDelta = GetVoltBenchmarkAllocatedBytes() - FrameStartAllocatedBytes;
+
+			Result.MaxFrameAllocatedBytesDelta = FMath::Max(Result.MaxFrameAllocatedBytesDelta, FrameAllocatedBytesDelta);
+
+			if (FrameAllocatedBytesDelta > 0) ++Result.NumFramesWithAllocatorGrowth;
+		}
+
+		Result.TotalFrameMs += FrameMs;
+		Result.MaxFrameMs = FMath::Max(Result.MaxFrameMs, FrameMs);
+		Result.GameThreadMs += FPlatformTime::ToMilliseconds64(GameThreadEndCycles - FrameStartCycles);
+
+		const int32 NumTracks = AnimationManager->GetAnimationTracks().Num();
+
+		Result.MinTracks = FMath::Min(Result.MinTracks, NumTracks);
+		Result.MaxTracks = FMath::Max(Result.MaxTracks, NumTracks);
+	}
+
+	if (Result.bHasAllocatorStats) Result.AllocatedBytesDelta = GetVoltBenchmarkAllocatedBytes() - AllocatedBytesAtStart;
+	Result.ObjectCountDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectCountAtStart;
+
+	AnimationManager->RemoveFromRoot();
+	VOLT_RELEASE_MANAGER(&AnimationManager);
+
+	//Let the released tracks be drained before the next pass.
+	Subsystem->UpdateAnimations(0);
+
+	while (Subsystem->IsModuleUpdateThreadWorking())
+	{
+		FPlatformProcess::Yield();
+	}
+
+	return Result;
+}
+
+static FString FormatVoltBenchmarkResult(const FVoltBenchmarkResult& Result, const int32 NumSlates, const int32 NumFrames)
+{
+	const FString AllocationText = Result.bHasAllocatorStats
+		? FString::Printf(TEXT("Allocated Delta: %lld bytes, Max Frame Allocated Delta: %lld bytes, Frames With Allocator Growth: %d"),
+			Result.AllocatedBytesDelta,
+			Result.MaxFrameAllocatedBytesDelta,
+			Result.NumFramesWithAllocatorGrowth)
+		: FString(TEXT("Allocated Delta: n/a (the allocator doesn't report its stats - use -llm or -trace=memory)"));
+
+	return FString::Printf(TEXT("Slates: %d, Frames: %d | Avg Frame: %.4f ms, Max Frame: %.4f ms, Avg Game Thread: %.4f ms | Tracks: %d~%d | %s, Object Delta: %d"),
+		NumSlates,
+		NumFrames,
+		Result.TotalFrameMs / NumFrames,
+		Result.MaxFrameMs,
+		Result.GameThreadMs / NumFrames,
+		Result.MinTracks,
+		Result.MaxTracks,
+		*AllocationText,
+		Result.ObjectCountDelta);
+}
+
+static void RunVoltBenchmark(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+{
+	UVoltSubsystem* Subsystem = UVoltSubsystem::Get();
+
+	if (Subsystem == nullptr)
+	{
+		Ar.Log(TEXT("Volt.Benchmark : Volt subsystem is not available."));
+		return;
+	}
+
+	const int32 NumSlates = Args.IsValidIndex(0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+	const int32 NumFrames = Args.IsValidIndex(1) ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 600;
+	const FString Mode = Args.IsValidIndex(2) ? Args[2] : TEXT("Both");
+	const float DeltaTime = 1.f / 60.f;
+
+	TArray<bool> Passes;
+
+	if (Mode.Equals(TEXT("Single"), ESearchCase::IgnoreCase) || Mode.Equals(TEXT("Both"), ESearchCase::IgnoreCase)) Passes.Add(false);
+	if (Mode.Equals(TEXT("Multi"), ESearchCase::IgnoreCase) || Mode.Equals(TEXT("Both"), ESearchCase::IgnoreCase)) Passes.Add(true);
+
+	if (Passes.IsEmpty())
+	{
+		Ar.Logf(TEXT("Volt.Benchmark : Unknown mode '%s'. Use Single, Multi or Both."), *Mode);
+		return;
+	}
+
+	const bool bWasUtilizingMultithreading = Subsystem->IsUtilizingMultithreading();
+
+	for (const bool bMultithreading : Passes)
+	{
+		Subsystem->SetUtilizingMultithreading(bMultithreading);
+
+		if (bMultithreading && !Subsystem->IsUtilizingMultithreading())
+		{
+			Ar.Log(TEXT("Volt.Benchmark : The module update thread is not available. Skipped the multithreaded pass."));
+			continue;
+		}
+
+		const FVoltBenchmarkResult Result = RunVoltBenchmarkPass(Subsystem, NumSlates, NumFrames, DeltaTime);
+
+		Ar.Logf(TEXT("Volt.Benchmark [%s, Parallel Module Update : %s] %s"),
+			bMultithreading ? TEXT("Multi") : TEXT("Single"),
+			UVoltSettings::Get()->bUseParallelModuleUpdate ? TEXT("On") : TEXT("Off"),
+			*FormatVoltBenchmarkResult(Result, NumSlates, NumFrames));
+	}
+
+	Subsystem->SetUtilizingMultithreading(bWasUtilizingMultithreading);
+}
+
+/**
+ * A headless benchmark for the Volt animation update.
+ * It builds offscreen slates, plays a representative animation (sequence, simultaneous, delay, transform, color, opacity) on them with a dedicated animation manager,
+ * and advances the Volt subsystem with a fixed synthetic clock. Every track that finishes is played again, so the load stays the same for the whole run.
+ *
+ * Usage : Volt.Benchmark [NumSlates=500] [NumFrames=600] [Mode=Both] - Mode can be one of Single, Multi, Both.
+ * It doesn't need a renderer, so it can run on a headless machine with : -game -nullrhi -unattended -ExecCmds="Volt.Benchmark 1000 600 Both, Quit"
+ * It can't run in a commandlet since the module update thread doesn't work in the commandlet mode.
+ * The allocation numbers come from the allocator stats. Run with -llm or -trace=cpu,memory to break the allocations down under the Volt/Benchmark tag.
+ *
+ * Volt 1.3 : introduced.
+ */
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdVoltBenchmark(
+	TEXT("Volt.Benchmark"),
+	TEXT("Run a headless benchmark of the Volt animation update. Usage : Volt.Benchmark [NumSlates=500] [NumFrames=600] [Mode=Single|Multi|Both]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&RunVoltBenchmark));
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoltBenchmarkAutomationTest, "Volt.Benchmark.AnimationUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FVoltBenchmarkAutomationTest::RunTest(const FString& Parameters)
+{
+	UVoltSubsystem* Subsystem = UVoltSubsystem::Get();
+
+	if (!TestNotNull(TEXT("Volt subsystem"), Subsystem)) return false;
+
+	constexpr int32 NumSlates = 200;
+	constexpr int32 NumFrames = 120;
+
+	//Run on the calling thread only, so the result doesn't depend on the module update thread being available.
+	const bool bWasUtilizingMultithreading = Subsystem->IsUtilizingMultithreading();
+	Subsystem->SetUtilizingMultithreading(false);
+
+	const FVoltBenchmarkResult Result = RunVoltBenchmarkPass(Subsystem, NumSlates, NumFrames, 1.f / 60.f);
+
+	Subsystem->SetUtilizingMultithreading(bWasUtilizingMultithreading);
+
+	AddInfo(FormatVoltBenchmarkResult(Result, NumSlates, NumFrames));
+
+	//Every finished track is played again on the next frame, so the load must never drop to nothing or exceed a track per slate.
+	TestTrue(TEXT("Tracks have been played for the whole run"), Result.MinTracks > 0 && Result.MinTracks != MAX_int32);
+	TestTrue(TEXT("No more than a track per slate"), Result.MaxTracks <= NumSlates);
+
+	return true;
+}
+
+#endif
+
+#endif
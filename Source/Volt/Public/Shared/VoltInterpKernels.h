@@ -0,0 +1,164 @@
+﻿//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Layout/Margin.h"
+#include "Slate/WidgetTransform.h"
+#include "Math/VectorRegister.h"
+
+/**
+ * Vectorized interpolation kernels for the Volt interp modules.
+ * Each kernel processes 4 lanes at once with the same per-lane result as the scalar FMath / UKismetMathLibrary functions the modules used before,
+ * so a module can interpolate every component of its value (RGBA, LTRB, box overrides...) in a single pass instead of one call per component.
+ * The kernels only cover the components of a single module. Each module is still updated through its own ModifySlateVariable() call,
+ * and the modules of the same type on different tracks are not gathered into shared buffers, so a frame runs one kernel call per module.
+ *
+ * Lanes are loaded unaligned, so the kernels can work on the member storage of FLinearColor, FMargin or any plain float / double array directly.
+ */
+struct VOLT_API FVoltInterpKernels
+{
+public:
+
+	/**
+	 * Per-lane FMath::FInterpTo.
+	 * Lanes that are close enough to the target snap to it, like the scalar version does.
+	 * @param InOutCurrent 4 lanes of current values. Will be overwritten with the result.
+	 * @param InTarget 4 lanes of target values.
+	 */
+	template <typename ScalarType>
+	static FORCEINLINE void InterpTo4(ScalarType* InOutCurrent, const ScalarType* InTarget, const ScalarType DeltaTime, const ScalarType InterpSpeed)
+	{
+		if (InterpSpeed <= 0)
+		{
+			VectorStore(VectorLoad(InTarget), InOutCurrent);
+			return;
+		}
+
+		const auto Current = VectorLoad(InOutCurrent);
+		const auto Target = VectorLoad(InTarget);
+		const auto Dist = VectorSubtract(Target, Current);
+		const auto Alpha = VectorSetFloat1(FMath::Clamp<ScalarType>(DeltaTime * InterpSpeed, 0, 1));
+
+		const auto Result = VectorAdd(Current, VectorMultiply(Dist, Alpha));
+		const auto SnapMask = VectorCompareLT(VectorMultiply(Dist, Dist), VectorSetFloat1(static_cast<ScalarType>(SMALL_NUMBER)));
+
+		VectorStore(VectorSelect(SnapMask, Target, Result), InOutCurrent);
+	}
+
+	/**
+	 * Per-lane FMath::FInterpConstantTo.
+	 * @param InOutCurrent 4 lanes of current values. Will be overwritten with the result.
+	 * @param InTarget 4 lanes of target values.
+	 */
+	template <typename ScalarType>
+	static FORCEINLINE void InterpConstantTo4(ScalarType* InOutCurrent, const ScalarType* InTarget, const ScalarType DeltaTime, const ScalarType InterpSpeed)
+	{
+		const auto Current = VectorLoad(InOutCurrent);
+		const auto Target = VectorLoad(InTarget);
+		const auto Dist = VectorSubtract(Target, Current);
+		const auto Step = VectorSetFloat1(static_cast<ScalarType>(InterpSpeed * DeltaTime));
+
+		const auto Result = VectorAdd(Current, VectorMin(VectorMax(Dist, VectorNegate(Step)), Step));
+		const auto SnapMask = VectorCompareLT(VectorMultiply(Dist, Dist), VectorSetFloat1(static_cast<ScalarType>(SMALL_NUMBER)));
+
+		VectorStore(VectorSelect(SnapMask, Target, Result), InOutCurrent);
+	}
+
+	/**
+	 * Per-lane linear interpolation between InStart and InTarget. (Start + (Target - Start) * Alpha)
+	 * @param OutResult 4 lanes to write the result to. Can be the same storage as InStart or InTarget.
+	 */
+	template <typename ScalarType>
+	static FORCEINLINE void Lerp4(ScalarType* OutResult, const ScalarType* InStart, const ScalarType* InTarget, const ScalarType Alpha)
+	{
+		const auto Start = VectorLoad(InStart);
+		const auto Target = VectorLoad(InTarget);
+
+		VectorStore(VectorAdd(Start, VectorMultiply(VectorSubtract(Target, Start), VectorSetFloat1(Alpha))), OutResult);
+	}
+
+	/**
+	 * Evaluate the easing curve once for the given alpha.
+	 * UKismetMathLibrary::Ease(A, B, ...) is Lerp(A, B, EasedAlpha), so the eased alpha can be shared by every lane with Lerp4.
+	 */
+	static FORCEINLINE double EaseAlpha(const double Alpha, const EEasingFunc::Type EasingFunc, const double BlendExp, const int32 Steps)
+	{
+		return UKismetMathLibrary::Ease(0.0, 1.0, Alpha, EasingFunc, BlendExp, Steps);
+	}
+
+public:
+
+	/**
+	 * Rate based interpolation of all 4 channels of the color.
+	 */
+	static FORCEINLINE void InterpColor(FLinearColor& InOutCurrent, const FLinearColor& Target, const float DeltaTime, const float InterpSpeed, const bool bConstant)
+	{
+		if (bConstant)
+		{
+			InterpConstantTo4<float>(&InOutCurrent.R, &Target.R, DeltaTime, InterpSpeed);
+		}
+		else
+		{
+			InterpTo4<float>(&InOutCurrent.R, &Target.R, DeltaTime, InterpSpeed);
+		}
+	}
+
+	/**
+	 * Alpha based (eased) interpolation of all 4 channels of the color.
+	 */
+	static FORCEINLINE void EaseColor(FLinearColor& OutResult, const FLinearColor& Start, const FLinearColor& Target, const double Alpha, const EEasingFunc::Type EasingFunc, const double BlendExp, const int32 Steps)
+	{
+		Lerp4<float>(&OutResult.R, &Start.R, &Target.R, static_cast<float>(EaseAlpha(Alpha, EasingFunc, BlendExp, Steps)));
+	}
+
+	/**
+	 * Rate based interpolation of all 4 sides of the margin.
+	 */
+	static FORCEINLINE void InterpMargin(FMargin& InOutCurrent, const FMargin& Target, const float DeltaTime, const float InterpSpeed, const bool bConstant)
+	{
+		if (bConstant)
+		{
+			InterpConstantTo4<float>(&InOutCurrent.Left, &Target.Left, DeltaTime, InterpSpeed);
+		}
+		else
+		{
+			InterpTo4<float>(&InOutCurrent.Left, &Target.Left, DeltaTime, InterpSpeed);
+		}
+	}
+
+	/**
+	 * Alpha based (eased) interpolation of all 4 sides of the margin.
+	 */
+	static FORCEINLINE void EaseMargin(FMargin& OutResult, const FMargin& Start, const FMargin& Target, const double Alpha, const EEasingFunc::Type EasingFunc, const double BlendExp, const int32 Steps)
+	{
+		Lerp4<float>(&OutResult.Left, &Start.Left, &Target.Left, static_cast<float>(EaseAlpha(Alpha, EasingFunc, BlendExp, Steps)));
+	}
+
+	/**
+	 * Alpha based (eased) interpolation of the angle, scale, shear and translation of the widget transform.
+	 * The 7 components are packed into 2 passes of 4 lanes.
+	 */
+	static FORCEINLINE void EaseWidgetTransform(FWidgetTransform& OutResult, const FWidgetTransform& Start, const FWidgetTransform& Target, const double Alpha, const EEasingFunc::Type EasingFunc, const double BlendExp, const int32 Steps)
+	{
+		const double StartLanes[8] = { Start.Angle, Start.Scale.X, Start.Scale.Y, Start.Shear.X, Start.Shear.Y, Start.Translation.X, Start.Translation.Y, 0 };
+		const double TargetLanes[8] = { Target.Angle, Target.Scale.X, Target.Scale.Y, Target.Shear.X, Target.Shear.Y, Target.Translation.X, Target.Translation.Y, 0 };
+		const double EasedAlpha = EaseAlpha(Alpha, EasingFunc, BlendExp, Steps);
+
+		double ResultLanes[8];
+
+		Lerp4<double>(&ResultLanes[0], &StartLanes[0], &TargetLanes[0], EasedAlpha);
+		Lerp4<double>(&ResultLanes[4], &StartLanes[4], &TargetLanes[4], EasedAlpha);
+
+		OutResult.Angle = ResultLanes[0];
+		OutResult.Scale = FVector2D(ResultLanes[1], ResultLanes[2]);
+		OutResult.Shear = FVector2D(ResultLanes[3], ResultLanes[4]);
+		OutResult.Translation = FVector2D(ResultLanes[5], ResultLanes[6]);
+	}
+
+private:
+
+	static_assert(STRUCT_OFFSET(FLinearColor, A) - STRUCT_OFFSET(FLinearColor, R) == sizeof(float) * 3, "FVoltInterpKernels expects FLinearColor channels to be packed.");
+	static_assert(STRUCT_OFFSET(FMargin, Bottom) - STRUCT_OFFSET(FMargin, Left) == sizeof(float) * 3, "FVoltInterpKernels expects FMargin sides to be packed.");
+};
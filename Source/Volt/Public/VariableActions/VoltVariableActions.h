@@ -26,9 +26,13 @@ class VOLT_API UVoltVarAction_Opacity : public UVoltVariableActionBase
 	
 public:
 
+	UVoltVarAction_Opacity();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
@@ -43,9 +47,13 @@ class VOLT_API UVoltVarAction_WidgetTransform : public UVoltVariableActionBase
 
 public:
 
+	UVoltVarAction_WidgetTransform();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 };
 
 
@@ -60,9 +68,13 @@ class VOLT_API UVoltVarAction_WidgetTransformPivot : public UVoltVariableActionB
 	
 public:
 
+	UVoltVarAction_WidgetTransformPivot();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 };
 
 /**
@@ -76,9 +88,13 @@ class VOLT_API UVoltVarAction_ColorAndOpacity : public UVoltVariableActionBase
 	
 public:
 
+	UVoltVarAction_ColorAndOpacity();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
@@ -93,9 +109,13 @@ class VOLT_API UVoltVarAction_BackgroundColor : public UVoltVariableActionBase
 	
 public:
 
+	UVoltVarAction_BackgroundColor();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
@@ -110,9 +130,13 @@ class VOLT_API UVoltVarAction_ForegroundColor : public UVoltVariableActionBase
 	
 public:
 
+	UVoltVarAction_ForegroundColor();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
@@ -128,9 +152,13 @@ class VOLT_API UVoltVarAction_ChildSlotPadding : public UVoltVariableActionBase
 
 public:
 
+	UVoltVarAction_ChildSlotPadding();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
@@ -145,9 +173,13 @@ class VOLT_API UVoltVarAction_ParentSlotPadding : public UVoltVariableActionBase
 
 public:
 
+	UVoltVarAction_ParentSlotPadding();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
@@ -162,9 +194,13 @@ class VOLT_API UVoltVarAction_Box : public UVoltVariableActionBase
 	
 public:
 
+	UVoltVarAction_Box();
+
 	virtual bool CheckSupportWidget(TWeakPtr<SWidget> Slate) override;
 	
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply) override;
+
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget) override;
 	
 };
 
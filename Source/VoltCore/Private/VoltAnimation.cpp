@@ -20,3 +20,39 @@ const bool UVoltAnimation::IsActive() const
 	return false;
 }
 
+static uint32 HashModuleHierarchy(const TArray<TObjectPtr<UVoltModuleItem>>& Modules, uint32 Hash)
+{
+	Hash = HashCombine(Hash, GetTypeHash(Modules.Num()));
+
+	for (UVoltModuleItem* Module : Modules)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Module ? Module->GetClass() : nullptr));
+
+		if (Module == nullptr) continue;
+
+		if (IVoltSubModuleInterface* TheInterface = Cast<IVoltSubModuleInterface>(Module))
+		{
+			if (const TArray<TObjectPtr<UVoltModuleItem>>* Container = TheInterface->GetModuleContainer())
+			{
+				Hash = HashModuleHierarchy(*Container, Hash);
+			}
+		}
+	}
+
+	return Hash;
+}
+
+uint32 UVoltAnimation::GetModuleHierarchyHash() const
+{
+	return HashModuleHierarchy(Modules, GetTypeHash(GetClass()));
+}
+
+bool UVoltAnimation::ResetFromTemplate(const UVoltAnimation* Template)
+{
+	if (Template == nullptr || Template->GetClass() != GetClass()) return false;
+
+	UVoltModuleItem::CopyPropertyValuesFromTemplate(this, Template);
+
+	return UVoltModuleItem::ResetModulesFromTemplate(Modules, Template->Modules);
+}
+
@@ -7,7 +7,12 @@
 #include "VoltInterface.h"
 #include "VoltModuleItem.h"
 #include "VoltVariableBase.h"
+#include "VoltVariableActionBase.h"
 #include "VoltVariableCollection.h"
+#include "VoltSettings.h"
+#include "VoltSubModuleInterface.h"
+
+#include "Async/ParallelFor.h"
 
 
 FVoltAnimationTrack UVoltAnimationManager::PlayAnimationFor(TScriptInterface<IVoltInterface> TargetVoltInterface,
@@ -45,7 +50,12 @@ FVoltAnimationTrack UVoltAnimationManager::MakeTrackWith(TScriptInterface<IVoltI
 		return FVoltAnimationTrack::NullTrack;
 	}
 
-	UVoltAnimation* AnimationInstance = DuplicateObject<UVoltAnimation>(Animation, this);
+	UVoltAnimation* AnimationInstance = AcquirePooledAnimationInstance(Animation);
+
+	if (!AnimationInstance)
+	{
+		AnimationInstance = DuplicateObject<UVoltAnimation>(Animation, this);
+	}
 
 	if (!AnimationInstance)
 	{
@@ -62,46 +72,108 @@ FVoltAnimationTrack UVoltAnimationManager::MakeTrackWith(TScriptInterface<IVoltI
 	return FVoltAnimationTrack(VoltInterface, AnimationInstance);
 }
 
-void UVoltAnimationManager::EnqueueOnAddAnimationTrack(const FVoltAnimationTrack& Track)
+UVoltAnimation* UVoltAnimationManager::AcquirePooledAnimationInstance(const UVoltAnimation* Animation)
 {
-	if (!AddAnimationTrackQueue.Contains(Track))
+	FVoltAnimationInstancePool* Pool = AnimationInstancePool.Find(Animation->GetModuleHierarchyHash());
+
+	if (Pool == nullptr) return nullptr;
+
+	while (!Pool->Instances.IsEmpty())
 	{
-		AddAnimationTrackQueue.Add(Track);
+		UVoltAnimation* Instance = Pool->Instances.Pop();
+
+		if (Instance == nullptr || !Instance->IsValidLowLevel()) continue;
+
+		// The hash can collide, and the reset fails on any mismatch of the hierarchy. Let the instance go in that case.
+		if (Instance->ResetFromTemplate(Animation)) return Instance;
 	}
+
+	return nullptr;
 }
 
-void UVoltAnimationManager::EnqueueOnDeleteAnimationTrack(const FVoltAnimationTrack& Track)
+void UVoltAnimationManager::ReleaseAnimationInstanceToPool(UVoltAnimation* AnimationInstance)
 {
-	if (!DeleteAnimationTrackQueue.Contains(Track))
+	if (AnimationInstance == nullptr || AnimationInstance->GetOuter() != this) return;
+
+	const UVoltSettings* Settings = UVoltSettings::Get();
+
+	if (Settings == nullptr || Settings->MaxPooledAnimationInstances <= 0) return;
+
+	FVoltAnimationInstancePool& Pool = AnimationInstancePool.FindOrAdd(AnimationInstance->GetModuleHierarchyHash());
+
+	if (Pool.Instances.Num() >= Settings->MaxPooledAnimationInstances || Pool.Instances.Contains(AnimationInstance)) return;
+
+	//Don't keep the slates alive while the instance is in the pool.
+	for (UVoltModuleItem* Module : AnimationInstance->Modules)
 	{
-		DeleteAnimationTrackQueue.Add(Track);
+		if (Module) Module->SetVoltSlate(nullptr);
 	}
+
+	Pool.Instances.Add(AnimationInstance);
 }
 
-void UVoltAnimationManager::DequeueOnAddAnimationTrack(const FVoltAnimationTrack& Track)
+void UVoltAnimationManager::EnqueueOnAddAnimationTrack(const FVoltAnimationTrack& Track)
 {
-	AddAnimationTrackQueue.Remove(Track);
+	PendingAddAnimationTrackGuids.Add(Track.GetGUID());
+	
+	AnimationTrackRequestQueue.Enqueue({Track, FVoltAnimationTrackRequest::EType::Add});
 }
 
-void UVoltAnimationManager::DequeueOnDeleteAnimationTrack(const FVoltAnimationTrack& Track)
+void UVoltAnimationManager::EnqueueOnDeleteAnimationTrack(const FVoltAnimationTrack& Track)
 {
-	DeleteAnimationTrackQueue.Remove(Track);
+	AnimationTrackRequestQueue.Enqueue({Track, FVoltAnimationTrackRequest::EType::Delete});
 }
 
 void UVoltAnimationManager::ApplyQueuedAnimationTrackRequests()
 {
-	for (FVoltAnimationTrack& DeletionQueue : DeleteAnimationTrackQueue)
+	if (AnimationTrackRequestQueue.IsEmpty()) return;
+	
+	TMap<FGuid, FVoltAnimationTrack> TracksToAdd;
+	TArray<FVoltAnimationTrack> TracksToDelete;
+	TSet<FGuid> DeletedTrackGuids;
+
+	FVoltAnimationTrackRequest Request;
+	
+	while (AnimationTrackRequestQueue.Dequeue(Request))
+	{
+		const FGuid TrackGuid = Request.Track.GetGUID();
+		
+		switch (Request.Type)
+		{
+		case FVoltAnimationTrackRequest::EType::Add:
+
+			TracksToAdd.Add(TrackGuid, Request.Track);
+			
+			break;
+		case FVoltAnimationTrackRequest::EType::Delete:
+
+			{
+				//If the track was about to be added, cancel it. Otherwise, the track must be the one we have.
+				const bool bWasPendingAdd = TracksToAdd.Remove(TrackGuid) > 0;
+
+				if (!bWasPendingAdd && !AnimationTracks.Contains(Request.Track)) break;
+
+				bool bIsAlreadyDeleted = false;
+				DeletedTrackGuids.Add(TrackGuid, &bIsAlreadyDeleted);
+
+				if (!bIsAlreadyDeleted) TracksToDelete.Add(Request.Track);
+			}
+			
+			break;
+		}
+	}
+	
+	PendingAddAnimationTrackGuids.Reset();
+	
+	for (FVoltAnimationTrack& DeletionQueue : TracksToDelete)
 	{
 		ProcessDeleteAnimationTrack(DeletionQueue);
 	}
 	
-	for (FVoltAnimationTrack& AdditionQueue : AddAnimationTrackQueue)
+	for (TPair<FGuid, FVoltAnimationTrack>& AdditionQueue : TracksToAdd)
 	{
-		ProcessAddAnimationTrack(AdditionQueue);
+		ProcessAddAnimationTrack(AdditionQueue.Value);
 	}
-
-	AddAnimationTrackQueue.Empty();
-	DeleteAnimationTrackQueue.Empty();
 }
 
 void UVoltAnimationManager::ProcessAddAnimationTrack(FVoltAnimationTrack& Track)
@@ -155,9 +227,11 @@ void UVoltAnimationManager::ProcessDeleteAnimationTrack(FVoltAnimationTrack& Tra
 		OnTrackRemoved_NonDynamic.Broadcast(this, Track);
 	}
 	
-	//Release its animation.
+	//Release its animation. Volt 1.3 : The instance will be reused for the next track that plays an animation with the same module hierarchy.
 	if (Track.TargetAnimation)
 	{
+		ReleaseAnimationInstanceToPool(Track.TargetAnimation.Get());
+		
 		Track.TargetAnimation = nullptr;
 	}
 
@@ -186,17 +260,12 @@ void UVoltAnimationManager::FlushUnnecessaryTrack()
 
 bool UVoltAnimationManager::HasTrack(const FVoltAnimationTrack& Track)
 {
-	return AddAnimationTrackQueue.Contains(Track) || AnimationTracks.Contains(Track);
+	return PendingAddAnimationTrackGuids.Contains(Track.GetGUID()) || AnimationTracks.Contains(Track);
 }
 
 void UVoltAnimationManager::FlushTrack(const FVoltAnimationTrack& Track)
 {
-	if(!HasTrack(Track)) return;
-		
-	//If add queue has this one, remove as well.
-	DequeueOnAddAnimationTrack(Track);
-	
-	//Book that up for the deletion.
+	//Book that up for the deletion. If the track is still in the queue for the addition, the addition will be canceled when the queue is drained.
 	EnqueueOnDeleteAnimationTrack(Track);
 }
 
@@ -250,45 +319,121 @@ void UVoltAnimationManager::Tick(float DeltaTime)
 	//These actions must be atomic and done in only one thread.
 	if (!Subsystem->IsModuleUpdateThreadWorking())
 	{
-		ApplyVariables();
-		
-		FlushUnnecessaryTrack();
+		FinishUpdate();
 	}
 
 }
 
+void UVoltAnimationManager::TickManagers(const TArray<UVoltAnimationManager*>& AnimationManagers, float DeltaTime)
+{
+	const UVoltSubsystem* Subsystem = UVoltSubsystem::Get();
+
+	if (!Subsystem) return;
+
+	// Same as Tick(), but in phases - every manager has to take its requests before the modules of all managers are processed together.
+	if (!Subsystem->IsUtilizingMultithreading())
+	{
+		for (UVoltAnimationManager* AnimationManager : AnimationManagers)
+		{
+			if (AnimationManager) AnimationManager->ApplyQueuedAnimationTrackRequests();
+		}
+
+		ProcessModuleUpdateForManagers(AnimationManagers, DeltaTime);
+	}
+
+	if (!Subsystem->IsModuleUpdateThreadWorking())
+	{
+		for (UVoltAnimationManager* AnimationManager : AnimationManagers)
+		{
+			if (AnimationManager) AnimationManager->FinishUpdate();
+		}
+	}
+}
+
+void UVoltAnimationManager::FinishUpdate()
+{
+	ApplyVariables();
+		
+	FlushUnnecessaryTrack();
+}
+
 
 void UVoltAnimationManager::ApplyVariables()
 {
+	const UVoltSettings* Settings = UVoltSettings::Get();
+	
+	const bool bSkipUnchangedVariables = Settings != nullptr && Settings->bSkipUnchangedVariables;
+
+	//A slate can be animated by multiple tracks at once, but its collection must be applied only once.
+	TSet<UVoltVariableCollection*, DefaultKeyFuncs<UVoltVariableCollection*>, TInlineSetAllocator<16>> AppliedCollections;
+
+	int32 NumEntries = 0;
+	
 	for (FVoltAnimationTrack& AnimationTrack : AnimationTracks)
 	{
 		if(!AnimationTrack.TargetSlateInterface) continue;
 			
-		if (UVoltVariableCollection* Collection = AnimationTrack.TargetSlateInterface->GetVoltVariableCollection())
-		{
-			//Process all the queued variable to the actual list.
-			Collection->ProcessQueue();
-			
-			const TArray<UVoltVariableBase*>& Variables = Collection->GetVariables();
-				
-			const int IterNum = Variables.Num();
-			
-			TWeakPtr<SWidget> Slate = AnimationTrack.TargetSlateInterface->GetTargetSlate();
+		UVoltVariableCollection* Collection = AnimationTrack.TargetSlateInterface->GetVoltVariableCollection();
 
-			if(!Slate.IsValid()) continue;
+		if (Collection == nullptr) continue;
 
-			for (int i = 0; i < IterNum; ++i)
-			{
-				if (!Variables.IsValidIndex(i)) continue;
+		bool bIsAlreadyApplied = false;
+		AppliedCollections.Add(Collection, &bIsAlreadyApplied);
+
+		if (bIsAlreadyApplied) continue;
+		
+		//Process all the queued variable to the actual list.
+		Collection->ProcessQueue();
+
+		//Resolve the slate only once for the whole variables.
+		const TSharedPtr<SWidget> Slate = AnimationTrack.TargetSlateInterface->GetTargetSlate().Pin();
+
+		if(!Slate.IsValid()) continue;
+
+		const TSharedRef<SWidget> SlateRef = Slate.ToSharedRef();
 
-				if(UVoltVariableBase* Variable = Variables[i])
-				{
-					Variable->ApplyVariable(Slate);
-				}
+		//The remembered values describe what the previous slate has received - a new slate must receive every variable again.
+		if (!Collection->LastAppliedSlate.HasSameObject(Slate.Get()))
+		{
+			for (UVoltVariableBase* Variable : Collection->GetVariables())
+			{
+				if (Variable) Variable->MarkValueDirty();
 			}
-			
+
+			Collection->LastAppliedSlate = Slate;
 		}
 		
+		for (UVoltVariableBase* Variable : Collection->GetVariables())
+		{
+			if (Variable == nullptr) continue;
+
+			if (bSkipUnchangedVariables && !Variable->ConsumeValueChange()) continue;
+
+			UVoltVariableActionBase* Action = Variable->FindActionForWidget(SlateRef);
+
+			if (Action == nullptr) continue;
+			
+			const int32 SlotIndex = UVoltVariableCollection::GetVariableSlotIndex(Variable->GetClass());
+
+			if (SlotIndex >= VariableApplyBatches.Num()) VariableApplyBatches.SetNum(SlotIndex + 1);
+
+			VariableApplyBatches[SlotIndex].Add({Variable, Action, SlateRef});
+
+			++NumEntries;
+		}
+	}
+
+	if (NumEntries == 0) return;
+
+	// Apply the variables of the same type together.
+	for (TArray<FVoltVariableApplyEntry>& Batch : VariableApplyBatches)
+	{
+		for (const FVoltVariableApplyEntry& Entry : Batch)
+		{
+			Entry.Action->ApplyVariableToWidget(Entry.Variable, Entry.Widget);
+		}
+
+		Batch.Reset();
 	}
 }
 
@@ -309,55 +454,164 @@ void UVoltAnimationManager::ProcessModuleUpdate(float DeltaTime)
 {
 	for (FVoltAnimationTrack& AnimationTrack : AnimationTracks)
 	{
-		if (!AnimationTrack.TargetAnimation)
+		ProcessTrackModuleUpdate(AnimationTrack, DeltaTime);
+	}
+}
+
+void UVoltAnimationManager::ProcessModuleUpdateForManagers(const TArray<UVoltAnimationManager*>& AnimationManagers, float DeltaTime)
+{
+	const UVoltSettings* Settings = UVoltSettings::Get();
+
+	const bool bAllowParallel = Settings != nullptr && Settings->bUseParallelModuleUpdate;
+
+	// Partition the tracks by the slate they animate. The modules of the same slate share the variable collection, so they must not be processed concurrently.
+	// The target animations are resolved here, on the calling thread, so the workers never touch the soft object pointers.
+	TArray<TArray<FVoltTrackUpdateWork, TInlineAllocator<4>>> Partitions;
+	TArray<bool> PartitionCanGoWide;
+	TMap<const UObject*, int32> SlateToPartitionIndex;
+
+	for (UVoltAnimationManager* AnimationManager : AnimationManagers)
+	{
+		if (AnimationManager == nullptr) continue;
+
+		for (FVoltAnimationTrack& AnimationTrack : AnimationManager->AnimationTracks)
 		{
-			continue;
+			const UObject* SlateObject = AnimationTrack.TargetSlateInterface.GetObject();
+
+			int32& PartitionIndex = SlateToPartitionIndex.FindOrAdd(SlateObject, INDEX_NONE);
+
+			if (PartitionIndex == INDEX_NONE)
+			{
+				PartitionIndex = Partitions.AddDefaulted();
+				PartitionCanGoWide.Add(true);
+			}
+
+			UVoltAnimation* Animation = AnimationTrack.TargetAnimation.Get();
+
+			Partitions[PartitionIndex].Add({AnimationManager, &AnimationTrack, Animation});
+
+			if (bAllowParallel && PartitionCanGoWide[PartitionIndex] && Animation != nullptr)
+			{
+				PartitionCanGoWide[PartitionIndex] = CanUpdateModulesOffGameThread(Animation->Modules);
+			}
 		}
+	}
+
+	// Only the partitions with the native, already begun modules can go wide. The rest are processed on the calling thread as before.
+	TArray<int32> WidePartitionIndices;
 
-		if (!AnimationTrack.TargetSlateInterface)
+	if (bAllowParallel)
+	{
+		for (int32 PartitionIndex = 0; PartitionIndex < Partitions.Num(); ++PartitionIndex)
 		{
-			continue;
+			if (PartitionCanGoWide[PartitionIndex]) WidePartitionIndices.Add(PartitionIndex);
 		}
 
-		for (UVoltModuleItem* Module : AnimationTrack.TargetAnimation->Modules)
+		if (WidePartitionIndices.Num() < FMath::Max(Settings->ParallelModuleUpdateMinSlates, 1)) WidePartitionIndices.Reset();
+	}
+
+	const auto ProcessPartition = [&Partitions, DeltaTime](const int32 PartitionIndex)
+	{
+		for (const FVoltTrackUpdateWork& Work : Partitions[PartitionIndex])
+		{
+			Work.AnimationManager->ProcessTrackModuleUpdate(*Work.Track, Work.Animation, DeltaTime);
+		}
+	};
+
+	for (int32 PartitionIndex = 0; PartitionIndex < Partitions.Num(); ++PartitionIndex)
+	{
+		if (!WidePartitionIndices.IsEmpty() && PartitionCanGoWide[PartitionIndex]) continue;
+
+		ProcessPartition(PartitionIndex);
+	}
+
+	if (WidePartitionIndices.IsEmpty()) return;
+
+	ParallelFor(WidePartitionIndices.Num(), [&WidePartitionIndices, &ProcessPartition](const int32 Index)
+	{
+		ProcessPartition(WidePartitionIndices[Index]);
+	});
+}
+
+bool UVoltAnimationManager::CanUpdateModulesOffGameThread(const TArray<TObjectPtr<UVoltModuleItem>>& Modules)
+{
+	for (UVoltModuleItem* Module : Modules)
+	{
+		if (Module == nullptr) continue;
+
+		// Blueprint modules run their events on the script VM, which must stay on the game thread.
+		if (!Module->GetClass()->HasAnyClassFlags(CLASS_Native)) return false;
+
+		// The begin play is where the modules create their variables on the collection (NewObject), so it must be done on the calling thread first.
+		if (!Module->IsBegunPlay()) return false;
+
+		if (IVoltSubModuleInterface* SubModuleInterface = Cast<IVoltSubModuleInterface>(Module))
 		{
-			if (!Module)
+			if (const TArray<TObjectPtr<UVoltModuleItem>>* SubModules = SubModuleInterface->GetModuleContainer(); SubModules != nullptr && !CanUpdateModulesOffGameThread(*SubModules))
 			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void UVoltAnimationManager::ProcessTrackModuleUpdate(FVoltAnimationTrack& AnimationTrack, float DeltaTime)
+{
+	ProcessTrackModuleUpdate(AnimationTrack, AnimationTrack.TargetAnimation.Get(), DeltaTime);
+}
+
+void UVoltAnimationManager::ProcessTrackModuleUpdate(FVoltAnimationTrack& AnimationTrack, UVoltAnimation* Animation, float DeltaTime)
+{
+	if (!Animation)
+	{
+		return;
+	}
+
+	if (!AnimationTrack.TargetSlateInterface)
+	{
+		return;
+	}
+
+	for (UVoltModuleItem* Module : Animation->Modules)
+	{
+		if (!Module)
+		{
 #if WITH_EDITOR
-				UE_LOG(LogVoltCore, Log, TEXT("There is a empty module slot in the %s. Please check out the asset.")
-					   , *AnimationTrack.TargetAnimation.Get()->GetPathName());
+			UE_LOG(LogVoltCore, Log, TEXT("There is a empty module slot in the %s. Please check out the asset.")
+				   , *Animation->GetPathName());
 #endif
 
-				continue;
-			}
+			continue;
+		}
 
-			if (!AnimationTrack.TargetSlateInterface.GetObject())
-			{
+		if (!AnimationTrack.TargetSlateInterface.GetObject())
+		{
 #if WITH_EDITOR
-				UE_LOG(LogVoltCore, Log,
-					   TEXT(
-						   "VoltAnimationManager %s detected a slate interface that was not derived from UObject has been provided. Make sure to derive it from UObject."
-					   ), *this->GetName());
+			UE_LOG(LogVoltCore, Log,
+				   TEXT(
+					   "VoltAnimationManager %s detected a slate interface that was not derived from UObject has been provided. Make sure to derive it from UObject."
+				   ), *this->GetName());
 #endif
 
-				continue;
-			}
-
-			if (!Module->IsBegunPlay())
-			{
-				Module->BeginPlayModule();
-			}
-			
-			if(Module->IsEndedPlay()) continue;
+			continue;
+		}
 
-			if (!Module->IsActive())
-			{
-				Module->EndPlayModule();
-				continue;
-			}
+		if (!Module->IsBegunPlay())
+		{
+			Module->BeginPlayModule();
+		}
+		
+		if(Module->IsEndedPlay()) continue;
 
-			Module->ModifySlateVariable(DeltaTime, AnimationTrack.TargetSlateInterface);
+		if (!Module->IsActive())
+		{
+			Module->EndPlayModule();
+			continue;
 		}
+
+		Module->ModifySlateVariable(DeltaTime, AnimationTrack.TargetSlateInterface);
 	}
 }
 
@@ -368,6 +622,8 @@ void UVoltAnimationManager::ReleaseAll()
 
 	FlushAllTracks();
 
+	AnimationInstancePool.Empty();
+
 	SetOwnerVoltInterface(nullptr);
 }
 
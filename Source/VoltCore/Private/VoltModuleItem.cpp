@@ -78,6 +78,67 @@ void UVoltModuleItem::EndPlayModule()
 	OnModuleEndPlay();
 }
 
+bool UVoltModuleItem::ResetModuleFromTemplate(const UVoltModuleItem* Template)
+{
+	if (Template == nullptr || Template->GetClass() != GetClass()) return false;
+
+	CopyPropertyValuesFromTemplate(this, Template);
+
+	TargetSlate.Reset();
+
+	//Volt 1.3 : If this module supports sub-modules, reset them with the template's sub-modules as well.
+	if (IVoltSubModuleInterface* TheInterface = Cast<IVoltSubModuleInterface>(this))
+	{
+		const TArray<TObjectPtr<UVoltModuleItem>>* Container = TheInterface->GetModuleContainer();
+		
+		//The interface doesn't provide a const accessor, but the template's container will be only read here.
+		const TArray<TObjectPtr<UVoltModuleItem>>* TemplateContainer = Cast<IVoltSubModuleInterface>(const_cast<UVoltModuleItem*>(Template))->GetModuleContainer();
+
+		if (Container && TemplateContainer) return ResetModulesFromTemplate(*Container, *TemplateContainer);
+
+		return Container == TemplateContainer;
+	}
+
+	return true;
+}
+
+bool UVoltModuleItem::ResetModulesFromTemplate(const TArray<TObjectPtr<UVoltModuleItem>>& Modules, const TArray<TObjectPtr<UVoltModuleItem>>& TemplateModules)
+{
+	if (Modules.Num() != TemplateModules.Num()) return false;
+
+	for (int32 i = 0; i < Modules.Num(); ++i)
+	{
+		UVoltModuleItem* Module = Modules[i];
+		const UVoltModuleItem* TemplateModule = TemplateModules[i];
+
+		if (Module == nullptr || TemplateModule == nullptr)
+		{
+			if (Module != TemplateModule) return false;
+			
+			continue;
+		}
+
+		if (!Module->ResetModuleFromTemplate(TemplateModule)) return false;
+	}
+
+	return true;
+}
+
+void UVoltModuleItem::CopyPropertyValuesFromTemplate(UObject* Instance, const UObject* Template)
+{
+	if (Instance == nullptr || Template == nullptr || Instance->GetClass() != Template->GetClass()) return;
+
+	for (TFieldIterator<FProperty> It(Instance->GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+
+		//The instanced sub objects belong to each instance - they must not be shared with the template.
+		if (Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference)) continue;
+
+		Property->CopyCompleteValue_InContainer(Instance, Template);
+	}
+}
+
 void UVoltModuleItem::SetVoltSlate(const TScriptInterface<IVoltInterface>& Slate)
 {
 	TargetVoltSlate = Slate;
@@ -37,28 +37,25 @@ uint32 FVoltModuleRunnable::Run()
 {
 	while (!IsPendingKill())
 	{
-		// If we are already working, or if we are in commandlet mode, do nothing.
-		// This is to prevent re-entrance and processing during commandlet runs - it seems like the packaging process want all the existing threads to be joined to finish the process.
+		// If we are in commandlet mode, do nothing.
+		// This is to prevent processing during commandlet runs - it seems like the packaging process want all the existing threads to be joined to finish the process.
 		// if the semaphore is null, we are probably shutting down - exit.
-		if(IsWorking() || IsRunningCommandlet() || !ThreadRunEvent_Semaphore) return 0;
+		if(IsRunningCommandlet() || !ThreadRunEvent_Semaphore) return 0;
+
+		// Pick up the epoch the game thread has published. The acquire pairs with the release in MarkAsWorking(), so the work of the epoch is visible here.
+		const uint64 Epoch = TriggeredEpoch.load(std::memory_order_acquire);
 		
 		// Work only if we have something to do.
-		if (!AnimationManagers.IsEmpty())
+		if (Epoch != CompletedEpoch.load(std::memory_order_relaxed))
 		{
-			MarkAsWorking();
-
 			// Critical section - we are now working.
+			// The tracks are spread across the worker threads, and this call returns once all of them have been processed.
 			
-			for (UVoltAnimationManager* AnimationManager : AnimationManagers)
-			{
-				if (AnimationManager == nullptr) continue;
-			
-				AnimationManager->ProcessModuleUpdate(GetThreadWorkDeltaTime());
-			}
+			if (!AnimationManagers.IsEmpty()) UVoltAnimationManager::ProcessModuleUpdateForManagers(AnimationManagers, GetThreadWorkDeltaTime());
 
 			// End of critical section - we are done working.
 
-			UnmarkAsWorking();
+			UnmarkAsWorking(Epoch);
 		}
 			
 		// wait for the next trigger ( for the next frame - FVoltModuleRunnable::Run() can be triggered only one time per frame. )
@@ -106,7 +103,7 @@ void FVoltModuleRunnable::TriggerTask(float DeltaTime)
 	{
 		//If thread is already working, it will simply pile up the delta time, and do nothing.
 
-		ThreadWorkDeltaTime = ThreadWorkDeltaTime + DeltaTime;
+		PendingWorkDeltaTime = PendingWorkDeltaTime + DeltaTime;
 	}else
 	{
 		//If thread is not working, we can trigger it to work.
@@ -116,12 +113,16 @@ void FVoltModuleRunnable::TriggerTask(float DeltaTime)
 
 		ProcessAnimationManagerTrackQueue();
 	
-		ThreadWorkDeltaTime = DeltaTime;
+		ThreadWorkDeltaTime = PendingWorkDeltaTime + DeltaTime;
+
+		PendingWorkDeltaTime = 0;
 
 		// Only unlock if we have something to do.
 		if (!AnimationManagers.IsEmpty())
 		{
-			//Unlock the thread
+			//Publish the work, then unlock the thread
+			MarkAsWorking();
+			
 			UnlockSemaphore();
 		}
 	}
@@ -186,27 +187,28 @@ void FVoltModuleRunnable::ProcessAnimationManagerTrackQueue()
 
 void FVoltModuleRunnable::MarkAsWorking()
 {
-	bIsWorking = true;
+	TriggeredEpoch.fetch_add(1, std::memory_order_release);
 }
 
-void FVoltModuleRunnable::UnmarkAsWorking()
+void FVoltModuleRunnable::UnmarkAsWorking(const uint64 Epoch)
 {
-	bIsWorking = false;
+	CompletedEpoch.store(Epoch, std::memory_order_release);
 }
 
 const bool FVoltModuleRunnable::IsWorking() const
 {
-	return bIsWorking;
+	// The acquire pairs with the release in UnmarkAsWorking(), so the result of the module update is visible once this returns false.
+	return TriggeredEpoch.load(std::memory_order_relaxed) != CompletedEpoch.load(std::memory_order_acquire);
 }
 
 void FVoltModuleRunnable::MarkAsPendingKill()
 {
-	bPendingKill = true;
+	bPendingKill.store(true, std::memory_order_release);
 }
 
 const bool FVoltModuleRunnable::IsPendingKill() const
 {
-	return bPendingKill;
+	return bPendingKill.load(std::memory_order_acquire);
 }
 
 const float& FVoltModuleRunnable::GetThreadWorkDeltaTime() const
@@ -7,6 +7,7 @@
 #include "VoltModuleRunnable.h"
 #include "VoltProxy.h"
 #include "VoltSettings.h"
+#include "VoltVariableCollection.h"
 
 #include "Engine/Engine.h"
 #include "Framework/Application/SlateApplication.h"
@@ -18,8 +19,8 @@ void UVoltSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	SetUtilizingMultithreading(UVoltSettings::Get() ? UVoltSettings::Get()->bUseMultithreadingOnModuleUpdate : false);
 
 	CacheCleanUpInterval();
-	
-	PopulateModuleUpdateThreadIfNeeded();
+
+	UVoltVariableCollection::RegisterVariableSlots();
 
 	//We do not start the tick with it
 	BindOnSlateApplicationPreTick();
@@ -69,6 +70,22 @@ void UVoltSubsystem::TryDiscardAbandonedInstancesByInterval()
 
 void UVoltSubsystem::UpdateAnimations(float DeltaTime)
 {
+	if (!IsUtilizingMultithreading() && UVoltSettings::Get()->bUseParallelModuleUpdate)
+	{
+		// Without the module update thread, tick every manager at once so their modules can be spread across the worker threads.
+		
+		TArray<UVoltAnimationManager*> AnimationManagers;
+		AnimationManagers.Reserve(RegisteredAnimationManager.Num());
+
+		for (UVoltAnimationManager* AnimationManager : RegisteredAnimationManager)
+		{
+			if(AnimationManager != nullptr) AnimationManagers.Add(AnimationManager);
+		}
+
+		UVoltAnimationManager::TickManagers(AnimationManagers, DeltaTime);
+
+		return;
+	}
 	
 	for (UVoltAnimationManager* AnimationManager : RegisteredAnimationManager)
 	{
@@ -114,9 +131,7 @@ void UVoltSubsystem::RemoveAnimationManagerOnModuleUpdateThread(UVoltAnimationMa
 
 void UVoltSubsystem::PopulateModuleUpdateThreadIfNeeded()
 {
-	ReleaseModuleUpdateThread();
-	
-	//fallback
+	//Keep the running thread - SetUtilizingMultithreading() has already handed the managers over to it.
 	if(!bIsUtilizingMultiThread || ModuleUpdateThread != nullptr) return;
 
 	ModuleUpdateThread = MakeUnique<FVoltModuleRunnable>();
@@ -141,11 +156,24 @@ const bool UVoltSubsystem::IsUtilizingMultithreading() const
 void UVoltSubsystem::SetUtilizingMultithreading(const bool bNewMultithreading)
 {
 	if(bIsUtilizingMultiThread == bNewMultithreading) return;
-	
-	if(bNewMultithreading) PopulateModuleUpdateThreadIfNeeded();
-	else ReleaseModuleUpdateThread();
 
+	//The flag must be updated first - PopulateModuleUpdateThreadIfNeeded() relies on it.
 	bIsUtilizingMultiThread = bNewMultithreading;
+	
+	if(bNewMultithreading)
+	{
+		PopulateModuleUpdateThreadIfNeeded();
+
+		//Hand the registered managers over to the new thread.
+		for (UVoltAnimationManager* AnimationManager : RegisteredAnimationManager)
+		{
+			AddAnimationManagerOnModuleUpdateThread(AnimationManager);
+		}
+	}
+	else
+	{
+		ReleaseModuleUpdateThread();
+	}
 }
 
 
@@ -12,3 +12,8 @@ void UVoltVariableActionBase::ApplyVariable(UVoltVariableBase* Variable, TWeakPt
 {
 	//Does nothing on base class.
 }
+
+void UVoltVariableActionBase::ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget)
+{
+	ApplyVariable(Variable, Widget.ToWeakPtr());
+}
@@ -17,6 +17,8 @@ void UVoltVariableBase::CacheActions()
 
 	//Mark that we already cached the data even if it might fail at the cache action.
 	bCachedActions = true;
+
+	bCanCacheActionByWidgetType = true;
 	
 	//Make a new action bases for the variable.
 	CachedActions.Reserve(ActionsForVariables.Num());
@@ -25,6 +27,8 @@ void UVoltVariableBase::CacheActions()
 	{
 		UVoltVariableActionBase* NewAction = NewObject<UVoltVariableActionBase>(this,Action);
 		CachedActions.Emplace(NewAction);
+
+		if (NewAction && !NewAction->bSupportDependsOnWidgetTypeOnly) bCanCacheActionByWidgetType = false;
 	}
 }
 
@@ -32,21 +36,135 @@ void UVoltVariableBase::ClearCachedActions()
 {
 	CachedActions.Empty();
 	bCachedActions = false;
+
+	CachedWidgetType = NAME_None;
+	CachedActionForWidgetType = nullptr;
+	bCanCacheActionByWidgetType = false;
 }
 
 void UVoltVariableBase::ApplyVariable(const TWeakPtr<SWidget>& SlateToApply)
+{
+	const TSharedPtr<SWidget> Slate = SlateToApply.Pin();
+
+	if (!Slate.IsValid()) return;
+
+	if (UVoltVariableActionBase* ActionBase = FindActionForWidget(Slate.ToSharedRef()))
+	{
+		ActionBase->ApplyVariableToWidget(this, Slate.ToSharedRef());
+	}
+}
+
+UVoltVariableActionBase* UVoltVariableBase::FindActionForWidget(const TSharedRef<SWidget>& Widget)
 {
 	if(!CheckCachedActions()) CacheActions();
+
+	const FName WidgetType = Widget->GetType();
+
+	if (bCanCacheActionByWidgetType && CachedWidgetType == WidgetType && CachedWidgetType != NAME_None) return CachedActionForWidgetType;
+
+	UVoltVariableActionBase* FoundAction = nullptr;
 	
 	for (UVoltVariableActionBase* ActionBase : CachedActions)
 	{
 		if (!ActionBase) continue;
 
-		if (ActionBase->CheckSupportWidget(SlateToApply))
+		if (ActionBase->CheckSupportWidget(Widget.ToWeakPtr()))
 		{
-			ActionBase->ApplyVariable(this, SlateToApply);
+			FoundAction = ActionBase;
 
 			break;
 		}
 	}
+
+	if (bCanCacheActionByWidgetType)
+	{
+		CachedWidgetType = WidgetType;
+		CachedActionForWidgetType = FoundAction;
+	}
+
+	return FoundAction;
+}
+
+bool UVoltVariableBase::ConsumeValueChange()
+{
+	if (AppliedValueSnapshotOffsets.IsEmpty())
+	{
+		//Collect the value properties and allocate the snapshot on the first call.
+		ValueProperties.Reset();
+
+		int32 SnapshotSize = 0;
+		
+		for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			//Skip the action related properties of the base class.
+			if (Property->GetOwnerClass() == UVoltVariableBase::StaticClass()) continue;
+
+			SnapshotSize = Align(SnapshotSize, Property->GetMinAlignment());
+
+			ValueProperties.Add(Property);
+			AppliedValueSnapshotOffsets.Add(SnapshotSize);
+
+			SnapshotSize += Property->GetSize();
+		}
+
+		AppliedValueSnapshot.SetNumZeroed(SnapshotSize);
+
+		for (int32 i = 0; i < ValueProperties.Num(); ++i)
+		{
+			uint8* SnapshotValue = AppliedValueSnapshot.GetData() + AppliedValueSnapshotOffsets[i];
+			
+			ValueProperties[i]->InitializeValue(SnapshotValue);
+			ValueProperties[i]->CopyCompleteValue(SnapshotValue, ValueProperties[i]->ContainerPtrToValuePtr<void>(this));
+		}
+
+		//Keep an entry even if there is no value property, so we don't collect them again.
+		if (ValueProperties.IsEmpty()) AppliedValueSnapshotOffsets.Add(INDEX_NONE);
+
+		return true;
+	}
+
+	bool bChanged = false;
+
+	for (int32 i = 0; i < ValueProperties.Num(); ++i)
+	{
+		const FProperty* Property = ValueProperties[i];
+		
+		uint8* SnapshotValue = AppliedValueSnapshot.GetData() + AppliedValueSnapshotOffsets[i];
+		const void* CurrentValue = Property->ContainerPtrToValuePtr<void>(this);
+
+		if (Property->Identical(SnapshotValue, CurrentValue)) continue;
+
+		Property->CopyCompleteValue(SnapshotValue, CurrentValue);
+
+		bChanged = true;
+	}
+
+	// Variables without any value property can't tell the change, so always apply them.
+	return bChanged || ValueProperties.IsEmpty();
+}
+
+void UVoltVariableBase::MarkValueDirty()
+{
+	ReleaseAppliedValueSnapshot();
+}
+
+void UVoltVariableBase::BeginDestroy()
+{
+	ReleaseAppliedValueSnapshot();
+	
+	Super::BeginDestroy();
+}
+
+void UVoltVariableBase::ReleaseAppliedValueSnapshot()
+{
+	for (int32 i = 0; i < ValueProperties.Num(); ++i)
+	{
+		ValueProperties[i]->DestroyValue(AppliedValueSnapshot.GetData() + AppliedValueSnapshotOffsets[i]);
+	}
+
+	ValueProperties.Reset();
+	AppliedValueSnapshot.Reset();
+	AppliedValueSnapshotOffsets.Reset();
 }
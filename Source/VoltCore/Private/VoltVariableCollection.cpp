@@ -3,16 +3,82 @@
 #include "VoltVariableCollection.h"
 #include "VoltVariableBase.h"
 
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectIterator.h"
+
+namespace VoltVariableSlots
+{
+	FRWLock Lock;
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	using FClassKey = FName;
+
+	FClassKey MakeClassKey(const UClass* Type) { return FName(*Type->GetPathName()); }
+#else
+	using FClassKey = FTopLevelAssetPath;
+
+	FClassKey MakeClassKey(const UClass* Type) { return Type->GetClassPathName(); }
+#endif
+
+	/**
+	 * Keyed by the class path instead of the class pointer - a recompiled blueprint class keeps its path and takes over the slot of the class it replaces,
+	 * so the table doesn't grow on every recompile, and a new class allocated on the address of a freed class never gets its slot.
+	 */
+	TMap<FClassKey, int32> ClassToSlotIndex;
+}
+
+int32 UVoltVariableCollection::GetVariableSlotIndex(const UClass* Type)
+{
+	if (Type == nullptr) return INDEX_NONE;
+
+	const VoltVariableSlots::FClassKey ClassPath = VoltVariableSlots::MakeClassKey(Type);
+
+	{
+		FReadScopeLock ReadLock(VoltVariableSlots::Lock);
+
+		if (const int32* FoundIndex = VoltVariableSlots::ClassToSlotIndex.Find(ClassPath)) return *FoundIndex;
+	}
+
+	FWriteScopeLock WriteLock(VoltVariableSlots::Lock);
+
+	// Another thread could have registered it while we were waiting for the lock.
+	if (const int32* FoundIndex = VoltVariableSlots::ClassToSlotIndex.Find(ClassPath)) return *FoundIndex;
+
+	const int32 NewIndex = VoltVariableSlots::ClassToSlotIndex.Num();
+
+	VoltVariableSlots::ClassToSlotIndex.Add(ClassPath, NewIndex);
+
+	return NewIndex;
+}
+
+void UVoltVariableCollection::RegisterVariableSlots()
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->IsChildOf(UVoltVariableBase::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists))
+		{
+			GetVariableSlotIndex(*It);
+		}
+	}
+}
+
 UVoltVariableBase* UVoltVariableCollection::FindOrAddVariable(TSubclassOf<UVoltVariableBase> Type)
 {
-	if(!Type->IsValidLowLevel()) return nullptr;
+	if(!Type || !Type->IsValidLowLevel()) return nullptr;
 
-	if(UVoltVariableBase* FoundVariable = FindVariable(Type)) return FoundVariable;
+	const int32 SlotIndex = GetVariableSlotIndex(Type);
+
+	if(VariableSlots.IsValidIndex(SlotIndex) && VariableSlots[SlotIndex] != nullptr) return VariableSlots[SlotIndex];
 
 	//Add a new one.
 
 	UVoltVariableBase* Base = NewObject<UVoltVariableBase>(this,Type);
 
+	if(SlotIndex >= VariableSlots.Num()) VariableSlots.SetNum(SlotIndex + 1);
+
+	VariableSlots[SlotIndex] = Base;
+
 	EnqueueVariableOnQueue(Base);
 	
 	return Base;
@@ -22,29 +88,9 @@ UVoltVariableBase* UVoltVariableCollection::FindVariable(TSubclassOf<UVoltVariab
 {
 	if(!Type || !Type->IsValidLowLevel()) return nullptr;
 
-	const int QueuedVariablesNum = QueuedVariables.Num();
-	for (int i = QueuedVariablesNum - 1; i >= 0; --i)
-	{
-		UVoltVariableBase* Variable = QueuedVariables[i];
-		
-		if(Variable == nullptr) continue;
-		if(Variable->GetClass() != Type) continue;
-
-		return Variable;
-	} 
-
-	const int VariablesNum = Variables.Num();
-	for (int i = VariablesNum - 1; i >= 0; --i)
-	{
-		UVoltVariableBase* Variable = Variables[i];
-		
-		if(Variable == nullptr) continue;
-		if(Variable->GetClass() != Type) continue;
+	const int32 SlotIndex = GetVariableSlotIndex(Type);
 
-		return Variable;
-	} 
-	
-	return nullptr;
+	return VariableSlots.IsValidIndex(SlotIndex) ? VariableSlots[SlotIndex].Get() : nullptr;
 }
 
 const TArray<UVoltVariableBase*>& UVoltVariableCollection::GetVariables()
@@ -31,5 +31,19 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category="Animation")
 	const bool IsActive() const;
+
+public:
+
+	/**
+	 * Get a hash of the module hierarchy of this animation. (the classes of the animation and the modules, and the number of the sub-modules)
+	 * The animations that have the same hash can share the same pooled instances in UVoltAnimationManager.
+	 */
+	uint32 GetModuleHierarchyHash() const;
+
+	/**
+	 * Reset this animation instance to the state of the provided template animation so it can be played again.
+	 * @return false if the module hierarchy doesn't match with the template's. The instance must not be reused in that case.
+	 */
+	bool ResetFromTemplate(const UVoltAnimation* Template);
 	
 };
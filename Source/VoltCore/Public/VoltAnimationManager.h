@@ -6,6 +6,7 @@
 #include "VoltAnimationTrack.h"
 #include "VoltInterface.h"
 #include "VoltSubsystem.h"
+#include "Containers/Queue.h"
 #include "Misc/Attribute.h"
 #include "Templates/SubclassOf.h"
 #include "Engine/Engine.h"
@@ -15,6 +16,10 @@ class UVoltSubsystem;
 class UVoltProxy;
 class UVoltAnimation;
 class UVoltAnimationManager;
+class UVoltModuleItem;
+class UVoltVariableBase;
+class UVoltVariableActionBase;
+class SWidget;
 
 /**
  * IMPORTANT : VOLT 1.1 now supports tick action on every situation. Just use it as you want!
@@ -55,6 +60,18 @@ class UVoltAnimationManager;
 
 
 
+/**
+ * Finished animation instances that share the same module hierarchy, kept for the reuse.
+ */
+USTRUCT()
+struct VOLTCORE_API FVoltAnimationInstancePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UVoltAnimation>> Instances;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAnimationPlayed,
                                                UVoltAnimationManager*, Manager,
                                                const FVoltAnimationTrack&, Track,
@@ -100,6 +117,7 @@ public:
 	/**
 	 * Play a certain animation with the specified Volt Interface, and return the animation track for the animation.
 	 * If you're looking for the functions that can stop the animations, look for the function with "track" on its name.
+	 * This must be called on the game thread since it creates the animation instance for the track.
 	 * @param TargetVoltInterface Target Volt Interface to play animation with.
 	 * @param Animation The animation to play.
 	 * @return The track of the animation. if something went wrong, it will return FVoltAnimationTrack::NullTrack instead.
@@ -119,10 +137,28 @@ private:
 	 */
 	FVoltAnimationTrack MakeTrackWith(TScriptInterface<IVoltInterface> VoltInterface, const UVoltAnimation* Animation);
 
+	/**
+	 * Take a pooled animation instance that has the same module hierarchy with the provided animation, and reset it to the provided animation's state.
+	 * @return The reset instance. nullptr if there was no instance to reuse.
+	 */
+	UVoltAnimation* AcquirePooledAnimationInstance(const UVoltAnimation* Animation);
+
+	/**
+	 * Return the animation instance of a removed track to the pool.
+	 */
+	void ReleaseAnimationInstanceToPool(UVoltAnimation* AnimationInstance);
+
+	/**
+	 * Finished animation instances, keyed by their module hierarchy hash. (See UVoltAnimation::GetModuleHierarchyHash())
+	 */
+	UPROPERTY(Transient)
+	TMap<uint32, FVoltAnimationInstancePool> AnimationInstancePool;
+
 public:
 	
 	/**
 	 * Flush specific animation track.
+	 * Volt 1.3 : Safe to call from any thread. The request is validated when the queue is drained, and flushing a track that this manager doesn't have does nothing.
 	 * @param Track The track to flush.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Animation")
@@ -152,6 +188,7 @@ public:
 
 	/**
 	 * Check whether it has the specified animation track. 
+	 * This must be called on the game thread.
 	 * @param Track The track to check 
 	 * @return whether it has the specified animation track.
 	 */
@@ -183,20 +220,37 @@ private:
 
 	/**
 	 * Volt 1.1 : Now track addition & deletion actions are asynchronous. We queue all the requests in the queues for each action, and handle them when the volt update thread is ready to go. (sync with it.)
+	 * Volt 1.3 : Both actions share a single lock-free MPSC queue, so the requests can be enqueued from any thread while the game thread is the only consumer. The requests are validated and deduplicated when they are drained.
 	 * Don't touch it if you don't fully understand the code.
 	 */
-	
-	TSet<FVoltAnimationTrack> AddAnimationTrackQueue;
-	
-	TSet<FVoltAnimationTrack> DeleteAnimationTrackQueue;
 
-	FORCEINLINE void EnqueueOnAddAnimationTrack(const FVoltAnimationTrack& Track);
+	/**
+	 * A queued request for the track addition or deletion.
+	 */
+	struct FVoltAnimationTrackRequest
+	{
+		enum class EType : uint8
+		{
+			Add,
+			Delete
+		};
 
-	FORCEINLINE void EnqueueOnDeleteAnimationTrack(const FVoltAnimationTrack& Track);
+		FVoltAnimationTrack Track;
 
-	FORCEINLINE void DequeueOnAddAnimationTrack(const FVoltAnimationTrack& Track);
+		EType Type = EType::Add;
+	};
 
-	FORCEINLINE void DequeueOnDeleteAnimationTrack(const FVoltAnimationTrack& Track);
+	TQueue<FVoltAnimationTrackRequest, EQueueMode::Mpsc> AnimationTrackRequestQueue;
+
+	/**
+	 * Guids of the tracks that have been played but not added to the AnimationTracks yet.
+	 * Only touched on the game thread - by PlayAnimationFor() and ApplyQueuedAnimationTrackRequests().
+	 */
+	TSet<FGuid> PendingAddAnimationTrackGuids;
+
+	FORCEINLINE void EnqueueOnAddAnimationTrack(const FVoltAnimationTrack& Track);
+
+	FORCEINLINE void EnqueueOnDeleteAnimationTrack(const FVoltAnimationTrack& Track);
 	
 	void ProcessAddAnimationTrack(FVoltAnimationTrack& Track);
 	
@@ -230,13 +284,80 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category="Animation")
 	void ProcessModuleUpdate(float DeltaTime);
+
+	/**
+	 * Tick the provided animation managers at once. It does the same thing as calling Tick() on each of them, but the module calculation of all managers is processed in one pass. (See ProcessModuleUpdateForManagers())
+	 * Volt 1.3 : introduced.
+	 * @param AnimationManagers Animation managers to tick.
+	 * @param DeltaTime Delta time from the last update.
+	 */
+	static void TickManagers(const TArray<UVoltAnimationManager*>& AnimationManagers, float DeltaTime);
+
+	/**
+	 * Process the module calculation of the provided animation managers at once, spreading the tracks across the worker threads.
+	 * The tracks are partitioned by the slate they animate, and the tracks of the same slate are processed on the same worker in the order of the managers and their tracks.
+	 * Only the partitions whose modules are all native and have already begun play go to the workers. The partitions with Blueprint modules or the modules that are about to begin play (and create their variables) are processed on the calling thread.
+	 * This function returns after every partition has been processed, so it's safe to apply the variables right after it.
+	 * @param AnimationManagers Animation managers to process.
+	 * @param DeltaTime Delta time from the last update.
+	 */
+	static void ProcessModuleUpdateForManagers(const TArray<UVoltAnimationManager*>& AnimationManagers, float DeltaTime);
 	
 	/**
 	 * Update all variables on the track to the real slate representation.
 	 * This function is not yet designed to be executed outside the game thread.
+	 * Volt 1.3 : The variables are batched by their type and applied in one pass. Each slate is resolved only once per frame even if it has multiple tracks, and the unchanged variables are skipped.
 	 */
 	virtual void ApplyVariables();
 
+private:
+
+	/**
+	 * Process the module calculation of a single track.
+	 */
+	void ProcessTrackModuleUpdate(FVoltAnimationTrack& AnimationTrack, float DeltaTime);
+
+	/**
+	 * Process the module calculation of a single track with its target animation that has been resolved already.
+	 */
+	void ProcessTrackModuleUpdate(FVoltAnimationTrack& AnimationTrack, UVoltAnimation* Animation, float DeltaTime);
+
+	/**
+	 * Whether the provided modules and their sub-modules can be updated on a worker thread.
+	 */
+	static bool CanUpdateModulesOffGameThread(const TArray<TObjectPtr<UVoltModuleItem>>& Modules);
+
+	/**
+	 * A track to update on ProcessModuleUpdateForManagers().
+	 */
+	struct FVoltTrackUpdateWork
+	{
+		UVoltAnimationManager* AnimationManager;
+		FVoltAnimationTrack* Track;
+		UVoltAnimation* Animation;
+	};
+
+	/**
+	 * Apply the variables and flush the finished tracks. It must be done on the game thread while the module update is not running.
+	 */
+	void FinishUpdate();
+
+	/**
+	 * An entry of the variable application batch.
+	 */
+	struct FVoltVariableApplyEntry
+	{
+		UVoltVariableBase* Variable;
+		UVoltVariableActionBase* Action;
+		TSharedRef<SWidget> Widget;
+	};
+
+	/**
+	 * The variable application batches, indexed by the variable slot index. (See UVoltVariableCollection::GetVariableSlotIndex())
+	 * It is kept only to reuse the allocations between the frames - it's empty outside ApplyVariables().
+	 */
+	TArray<TArray<FVoltVariableApplyEntry>> VariableApplyBatches;
+
 public:
 
 	/**
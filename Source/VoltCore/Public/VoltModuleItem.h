@@ -85,6 +85,28 @@ public:
 	 */
 	virtual void EndPlayModule();
 
+	/**
+	 * Reset the module to the state of the provided template module, so the instance can be played again without duplicating the template.
+	 * It copies every property value of the template (including the transient runtime states such as the begin / end play flags, accumulated time and the playback cursors of the sub-modules)
+	 * except the instanced sub-module containers, which will be reset module by module.
+	 * Volt 1.3 : introduced for the animation instance pool of UVoltAnimationManager.
+	 * @param Template The module to copy the state from. It must be the same class with this module.
+	 * @return false if the module hierarchy doesn't match with the template's. The instance must not be reused in that case.
+	 */
+	virtual bool ResetModuleFromTemplate(const UVoltModuleItem* Template);
+
+	/**
+	 * Reset the provided modules to the state of the template modules, one by one.
+	 * @return false if the number of the modules or the class of any module doesn't match.
+	 */
+	static bool ResetModulesFromTemplate(const TArray<TObjectPtr<UVoltModuleItem>>& Modules, const TArray<TObjectPtr<UVoltModuleItem>>& TemplateModules);
+
+	/**
+	 * Copy the property values of the template object to the instance, except the instanced object references.
+	 * Both objects must be the same class.
+	 */
+	static void CopyPropertyValuesFromTemplate(UObject* Instance, const UObject* Template);
+
 protected:
 
 	//Only events - No, you can't have a delegate on here! that's a huge overkill!
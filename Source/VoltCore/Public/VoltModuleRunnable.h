@@ -7,6 +7,8 @@
 #include "HAL/Runnable.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
 
+#include <atomic>
+
 /**
  * A thread for the module execution. This doesn't update the slate itself.
  */
@@ -77,9 +79,15 @@ private:
 	// unlock the semaphore to let the thread run.
 	void UnlockSemaphore();
 
+	/**
+	 * Publish a new work epoch to the thread. Must be called on the game thread while the thread is not working.
+	 */
 	FORCEINLINE void MarkAsWorking();
 
-	FORCEINLINE void UnmarkAsWorking();
+	/**
+	 * Mark the provided epoch as completed. Must be called on the thread after the work for the epoch is done.
+	 */
+	FORCEINLINE void UnmarkAsWorking(const uint64 Epoch);
 
 public:
 
@@ -97,17 +105,34 @@ private:
 	 */
 	TArray<UVoltAnimationManager*> DeletionBufferAnimationManagers;
 	
-	// Whether the thread is currently processing tasks - when Run() is executing.
-	bool bIsWorking = false;
+	/**
+	 * The epoch handshake between the game thread and the thread. The thread is working while these two differ.
+	 * Volt 1.3 : Replaced the plain bIsWorking flag.
+	 * 
+	 * The game thread is the only writer of TriggeredEpoch, and it publishes the work (delta time, synchronized manager list & tracks) before incrementing it (release).
+	 * The thread is the only writer of CompletedEpoch, and it publishes the result of the module update before storing it (release).
+	 * So whenever IsWorking() returns false, the game thread can safely touch the tracks and the variables.
+	 */
+	std::atomic<uint64> TriggeredEpoch{0};
 	
-	bool bPendingKill = false;
+	std::atomic<uint64> CompletedEpoch{0};
+	
+	std::atomic<bool> bPendingKill{false};
 	
 	FEvent* ThreadRunEvent_Semaphore;
 	
 	FRunnableThread* Thread = nullptr;
 
+	/**
+	 * Delta time for the epoch that is being processed. Only written by the game thread before publishing an epoch.
+	 */
 	float ThreadWorkDeltaTime = 0;
 
+	/**
+	 * Delta time that has been piled up while the thread was working. Only touched by the game thread.
+	 */
+	float PendingWorkDeltaTime = 0;
+
 public:
 
 	FORCEINLINE const float& GetThreadWorkDeltaTime() const;
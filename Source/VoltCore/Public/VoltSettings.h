@@ -48,6 +48,40 @@ public:
 	UPROPERTY(config, EditAnywhere, Category="Performance", DisplayName="Use Multithreading On Module Update")
 	bool bUseMultithreadingOnModuleUpdate = true;
 
+	/**
+	 * Whether to spread the module update of the tracks across the worker threads.
+	 * The tracks are partitioned by the slate they animate, so the tracks of the same slate are always updated together in the same order.
+	 * Only the tracks with native modules that have already begun play are spread. The modules must not touch anything but their own state and the variable collection of their slate on the update.
+	 * Volt 1.3 : introduced. Disabled by default.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Performance", DisplayName="Use Parallel Module Update")
+	bool bUseParallelModuleUpdate = false;
+
+	/**
+	 * The minimum number of the animated slates to spread the module update across the worker threads.
+	 * Below this, the module update will be processed on a single thread, since the dispatch cost will be bigger than the update itself.
+	 * Volt 1.3 : introduced.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Performance", DisplayName="Parallel Module Update Min Slates", meta=(ClampMin=1, EditCondition="bUseParallelModuleUpdate"))
+	int32 ParallelModuleUpdateMinSlates = 16;
+
+	/**
+	 * The maximum number of the finished animation instances that each animation manager keeps for the reuse, per module hierarchy.
+	 * Playing an animation will reuse a pooled instance instead of duplicating the animation when there is one. 0 disables the pooling.
+	 * Volt 1.3 : introduced.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Performance", DisplayName="Max Pooled Animation Instances", meta=(ClampMin=0))
+	int32 MaxPooledAnimationInstances = 8;
+
+	/**
+	 * Whether to skip applying the variables whose value hasn't been changed since the last application to the slate.
+	 * Keep this disabled if something else than Volt modifies the same attributes of the animated slates and Volt must overwrite them every frame.
+	 * The variables are always applied again when the slate of the interface has been replaced.
+	 * Volt 1.3 : introduced. Disabled by default.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Performance", DisplayName="Skip Unchanged Variables")
+	bool bSkipUnchangedVariables = false;
+
 	/**
 	 * Interval for the Volt Subsystem clean-up (GC) code.
 	 */
@@ -216,8 +216,13 @@ public:
 
 	const bool IsUtilizingMultithreading() const;
 
-private:
-	
+	/**
+	 * Turn the multithreaded module update on or off at runtime.
+	 * The module update thread is created or released accordingly, and the registered animation managers are handed over to the new thread.
+	 * Must be called on the game thread.
+	 * Volt 1.3 : Now public.
+	 * @param bNewMultithreading Whether to use the module update thread.
+	 */
 	void SetUtilizingMultithreading(const bool bNewMultithreading);
 
 private:
@@ -31,5 +31,23 @@ public:
 public:
 
 	virtual void ApplyVariable(UVoltVariableBase* Variable, TWeakPtr<SWidget> SlateToApply);
+
+	/**
+	 * Apply the variable to a widget that has been already resolved by the caller.
+	 * UVoltAnimationManager::ApplyVariables() uses this one to resolve each widget only once per frame.
+	 * The default implementation calls ApplyVariable() with the widget, so the actions that only override ApplyVariable() keep working.
+	 * Volt 1.3 : introduced.
+	 */
+	virtual void ApplyVariableToWidget(UVoltVariableBase* Variable, const TSharedRef<SWidget>& Widget);
+
+public:
+
+	/**
+	 * Whether the result of CheckSupportWidget() depends only on the type of the widget (SWidget::GetType()).
+	 * If true, the variables will cache the action that supports a widget type and skip the check for the widgets of the same type.
+	 * Volt 1.3 : introduced. Off by default, so the existing actions keep being checked on every widget. Set this to true on your action if its check only looks at the widget type. (The built-in actions do)
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Variable Action")
+	bool bSupportDependsOnWidgetTypeOnly = false;
 	
 };
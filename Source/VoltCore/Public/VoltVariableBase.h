@@ -57,6 +57,31 @@ public:
 	 */
 	void ApplyVariable(const TWeakPtr<SWidget>& SlateToApply);
 
+	/**
+	 * Find the cached action that supports the provided widget.
+	 * The result will be cached per widget type if every action of this variable supports that. (See UVoltVariableActionBase::bSupportDependsOnWidgetTypeOnly)
+	 * @return The action to apply this variable to the widget with. nullptr if none of them supports the widget.
+	 */
+	UVoltVariableActionBase* FindActionForWidget(const TSharedRef<SWidget>& Widget);
+
+	/**
+	 * Check whether the value of this variable has been changed since the last call, and remember the current value.
+	 * It compares the properties declared on the subclasses of UVoltVariableBase, so any variable type is supported without additional work.
+	 * The first call always returns true.
+	 */
+	bool ConsumeValueChange();
+
+	/**
+	 * Forget the remembered value, so the next ConsumeValueChange() returns true.
+	 */
+	void MarkValueDirty();
+
+	virtual void BeginDestroy() override;
+
+private:
+
+	void ReleaseAppliedValueSnapshot();
+
 public:
 
 	/**
@@ -81,4 +106,37 @@ public:
 	 */
 	UPROPERTY(VisibleAnywhere, Category="Variable Action")
 	bool bCachedActions;
+
+private:
+
+	/**
+	 * The widget type that CachedActionForWidgetType has been resolved for.
+	 */
+	FName CachedWidgetType = NAME_None;
+
+	/**
+	 * The action that supports the widgets of CachedWidgetType. It can be nullptr if none of them supports the type.
+	 */
+	UPROPERTY(Transient)
+	TObjectPtr<UVoltVariableActionBase> CachedActionForWidgetType;
+
+	/**
+	 * Whether the actions can be cached by the widget type.
+	 */
+	bool bCanCacheActionByWidgetType = false;
+
+	/**
+	 * The properties that hold the value of this variable. (The properties that are declared on the subclasses)
+	 */
+	TArray<const FProperty*> ValueProperties;
+
+	/**
+	 * The value of ValueProperties at the last ConsumeValueChange() call.
+	 */
+	TArray<uint8> AppliedValueSnapshot;
+
+	/**
+	 * Offset of each value property on AppliedValueSnapshot.
+	 */
+	TArray<int32> AppliedValueSnapshotOffsets;
 };
@@ -36,6 +36,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Animated Slate Variable")
 	const TArray<UVoltVariableBase*>& GetVariables();
 
+public:
+
+	/**
+	 * Get the slot index of the provided variable class. Each variable class path has a fixed slot index for the whole session, and the collections store their variables on that slot.
+	 * A recompiled blueprint class keeps the slot of the class it replaces.
+	 * The classes that haven't been registered yet will be registered on the first request. This function is thread-safe.
+	 * @param Type The variable class.
+	 * @return The slot index of the class. INDEX_NONE if the class is not valid.
+	 */
+	static int32 GetVariableSlotIndex(const UClass* Type);
+
+	/**
+	 * Register every loaded variable class to the slots at once.
+	 * UVoltSubsystem calls this on its initialization.
+	 */
+	static void RegisterVariableSlots();
+
 
 private:
 
@@ -57,4 +74,15 @@ private:
 
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UVoltVariableBase>> Variables;
+
+	/**
+	 * Every variable of this collection (both queued and processed), placed on the slot index of its class. (See GetVariableSlotIndex())
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UVoltVariableBase>> VariableSlots;
+
+	/**
+	 * The slate that the variables have been applied to last time. The remembered values of the variables are only valid for this slate.
+	 */
+	TWeakPtr<SWidget> LastAppliedSlate;
 };
\ No newline at end of file